@@ -0,0 +1,198 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Bench
+*/
+
+#include "Bench.hpp"
+
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+#include "../src/core/AllocCounter.hpp"
+#include "../src/core/Profiler.hpp"
+
+///////////////////////////////// BenchReport /////////////////////////////////
+
+/**
+ * @brief Construct a new BenchReport object
+ *
+ * @param suite The name of the suite, written in the report
+ * @param options The options of the run
+ */
+BenchReport::BenchReport(const std::string &suite,
+    const BenchOptions &options)
+    : _suite(suite), _options(options)
+{
+}
+
+/**
+ * @brief Check if a case matches the filter given on the command line
+ *
+ * @param name The name of the case
+ * @return true if the case must be run
+ */
+bool BenchReport::isSelected(const std::string &name) const
+{
+    return _options.filter.empty() ||
+        name.find(_options.filter) != std::string::npos;
+}
+
+/**
+ * @brief Run a case if it matches the filter and store its measures
+ *
+ * @param benchCase The case to run
+ */
+void BenchReport::run(const BenchCase &benchCase)
+{
+    if (!isSelected(benchCase.name))
+        return;
+    BenchResult result = measure(benchCase);
+    std::cerr << result.name << ": " << result.frames << " frames, p50 "
+              << result.p50 / 1e3 << " us, " << result.allocations
+              << " allocs/frame" << std::endl;
+    _results.push_back(result);
+}
+
+/**
+ * @brief Run a case and return its measures, without storing them
+ *
+ * A few warmup frames are run first so that the caches of the game and
+ * of the allocator are filled. The allocations are counted around the
+ * timed frames only. The filter is not checked, so a case can measure a
+ * reference that was filtered out.
+ *
+ * @param benchCase The case to run
+ * @return BenchResult The measures of the case
+ */
+BenchResult BenchReport::measure(const BenchCase &benchCase) const
+{
+    using Clock = std::chrono::steady_clock;
+    BenchResult result;
+    Histogram frameTime;
+    Histogram entities;
+    std::uint64_t allocations = 0;
+    std::uint64_t bytes = 0;
+    Clock::time_point start;
+    Clock::duration elapsed = Clock::duration::zero();
+
+    result.name = benchCase.name;
+    result.params = benchCase.params;
+    benchCase.setup();
+    for (int i = 0; i < BENCH_WARMUP_FRAMES; i++)
+        benchCase.frame();
+    while (result.frames < _options.maxFrames &&
+        (result.frames < BENCH_MIN_FRAMES ||
+        std::chrono::duration<double>(elapsed).count() < _options.maxSeconds)) {
+        if (benchCase.isDone && benchCase.isDone())
+            benchCase.setup();
+        std::uint64_t allocStart = AllocCounter::getCount();
+        std::uint64_t bytesStart = AllocCounter::getBytes();
+        start = Clock::now();
+        std::size_t count = benchCase.frame();
+        Clock::duration frame = Clock::now() - start;
+        allocations += AllocCounter::getCount() - allocStart;
+        bytes += AllocCounter::getBytes() - bytesStart;
+        elapsed += frame;
+        frameTime.record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(frame).count());
+        entities.record(count);
+        result.frames++;
+    }
+    result.seconds = std::chrono::duration<double>(elapsed).count();
+    result.mean = frameTime.getMean();
+    result.p50 = frameTime.getPercentile(50);
+    result.p95 = frameTime.getPercentile(95);
+    result.p99 = frameTime.getPercentile(99);
+    result.max = frameTime.getMax();
+    result.allocations = static_cast<double>(allocations) / result.frames;
+    result.bytes = static_cast<double>(bytes) / result.frames;
+    result.entities = entities.getMean();
+    if (benchCase.finish)
+        benchCase.finish(result);
+    return result;
+}
+
+/**
+ * @brief Write the report as JSON
+ *
+ * @return true on success, false if the output cannot be written
+ */
+bool BenchReport::write(void) const
+{
+    std::ofstream file;
+    std::ostream *out = &std::cout;
+
+    if (_options.output != "-") {
+        file.open(_options.output, std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Unable to open bench output: " << _options.output
+                      << std::endl;
+            return false;
+        }
+        out = &file;
+    }
+    *out << "{\n  \"suite\": \"" << _suite << "\",\n  \"results\": [";
+    for (std::size_t i = 0; i < _results.size(); i++) {
+        const BenchResult &result = _results[i];
+        *out << (i ? ",\n" : "\n") << "    {\"name\": \"" << result.name
+             << "\", \"params\": {";
+        for (std::size_t j = 0; j < result.params.size(); j++) {
+            *out << (j ? ", " : "") << "\"" << result.params[j].first
+                 << "\": \"" << result.params[j].second << "\"";
+        }
+        *out << "}, \"frames\": " << result.frames
+             << ", \"seconds\": " << result.seconds
+             << ", \"fps\": " << result.frames / result.seconds
+             << ", \"mean_ns\": " << result.mean
+             << ", \"p50_ns\": " << result.p50
+             << ", \"p95_ns\": " << result.p95
+             << ", \"p99_ns\": " << result.p99
+             << ", \"max_ns\": " << result.max
+             << ", \"allocs_per_frame\": " << result.allocations
+             << ", \"bytes_per_frame\": " << result.bytes
+             << ", \"entities\": " << result.entities;
+        for (const auto &[metric, value] : result.metrics)
+            *out << ", \"" << metric << "\": " << value;
+        *out << "}";
+    }
+    *out << "\n  ]\n}\n";
+    return out->good();
+}
+
+/////////////////////////////////// Options ///////////////////////////////////
+
+/**
+ * @brief Parse the options shared by the benchmark drivers
+ *
+ * @param ac The number of arguments
+ * @param av The arguments
+ * @param options Filled with the parsed options
+ * @return true on success, false on an invalid option
+ */
+bool parseBenchOptions(int ac, char **av, BenchOptions &options)
+{
+    try {
+        for (int i = 1; i < ac; i++) {
+            if (std::strcmp(av[i], "--frames") == 0 && i + 1 < ac) {
+                options.maxFrames = std::stoull(av[++i]);
+            } else if (std::strcmp(av[i], "--seconds") == 0 && i + 1 < ac) {
+                options.maxSeconds = std::stod(av[++i]);
+            } else if (std::strcmp(av[i], "--out") == 0 && i + 1 < ac) {
+                options.output = av[++i];
+            } else if (std::strcmp(av[i], "--filter") == 0 && i + 1 < ac) {
+                options.filter = av[++i];
+            } else {
+                std::cerr << "Invalid option: " << av[i] << std::endl;
+                return false;
+            }
+        }
+    } catch (const std::exception &e) {
+        std::cerr << "Invalid value: " << e.what() << std::endl;
+        return false;
+    }
+    return options.maxFrames > 0;
+}
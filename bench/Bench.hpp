@@ -0,0 +1,93 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Bench
+*/
+
+#ifndef BENCH_HPP_
+    #define BENCH_HPP_
+
+    #include <cstdint>
+    #include <functional>
+    #include <string>
+    #include <utility>
+    #include <vector>
+
+    #define BENCH_DEFAULT_FRAMES 2000
+    #define BENCH_DEFAULT_SECONDS 2.0
+    #define BENCH_MIN_FRAMES 10
+    #define BENCH_WARMUP_FRAMES 5
+
+/**
+ * @brief Options shared by the benchmark drivers
+ *
+ * Each case runs until it reached maxFrames or spent maxSeconds, but at
+ * least BENCH_MIN_FRAMES frames, so that small boards get many samples
+ * and huge ones still finish.
+ */
+struct BenchOptions {
+    std::uint64_t maxFrames = BENCH_DEFAULT_FRAMES;
+    double maxSeconds = BENCH_DEFAULT_SECONDS;
+    std::string output = "-";
+    std::string filter;
+};
+
+/**
+ * @brief Measures of one benchmark case
+ *
+ * Times are per frame in nanoseconds, allocations and bytes are averaged
+ * per frame.
+ */
+struct BenchResult {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> params;
+    std::uint64_t frames = 0;
+    double seconds = 0;
+    double mean = 0;
+    std::uint64_t p50 = 0;
+    std::uint64_t p95 = 0;
+    std::uint64_t p99 = 0;
+    std::uint64_t max = 0;
+    double allocations = 0;
+    double bytes = 0;
+    double entities = 0;
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+/**
+ * @brief A benchmark case
+ *
+ * setup is called before the first frame and every time isDone returns
+ * true; neither is timed. frame is the timed work and returns the number
+ * of entities it produced. finish, if any, adds the metrics measured by
+ * the case itself once it is over.
+ */
+struct BenchCase {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> params;
+    std::function<void(void)> setup;
+    std::function<std::size_t(void)> frame;
+    std::function<bool(void)> isDone;
+    std::function<void(BenchResult &)> finish;
+};
+
+class BenchReport {
+    public:
+        BenchReport(const std::string &suite, const BenchOptions &options);
+        ~BenchReport() = default;
+
+        bool isSelected(const std::string &name) const;
+        void run(const BenchCase &benchCase);
+        BenchResult measure(const BenchCase &benchCase) const;
+        bool write(void) const;
+
+    private:
+        std::string _suite;
+        BenchOptions _options;
+        std::vector<BenchResult> _results;
+};
+
+bool parseBenchOptions(int ac, char **av, BenchOptions &options);
+
+#endif /* !BENCH_HPP_ */
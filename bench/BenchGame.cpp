@@ -0,0 +1,139 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** BenchGame
+*/
+
+#include "BenchGame.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+/**
+ * @brief Destroy the game before its library is closed
+ */
+BenchGame::~BenchGame()
+{
+    _game.reset();
+}
+
+/**
+ * @brief Load a game library with a knob set in the environment
+ *
+ * @param path The path of the game library
+ * @param env The environment variable read by the game, or nullptr
+ * @param value The value of the variable
+ */
+void BenchGame::load(const std::string &path, const char *env,
+    const std::string &value)
+{
+    _game.reset();
+    if (env)
+        setenv(env, value.c_str(), 1);
+    _game.reset(_loader.getInstance(path));
+    if (env)
+        unsetenv(env);
+    _game->setSeed(BENCH_SEED);
+    _game->setUsername("bench");
+    _fixedStep.reset();
+}
+
+/**
+ * @brief Load the menu
+ */
+void BenchGame::startMenu(void)
+{
+    load(MENU_LIB, nullptr, "");
+}
+
+/**
+ * @brief Load Minesweeper, start a game and reveal the center cell
+ *
+ * @param board The board to play on
+ */
+void BenchGame::startMinesweeper(const MinesweeperBoard &board)
+{
+    load(MINESWEEPER_LIB, "ARCADE_MINESWEEPER_BOARD",
+        std::to_string(board.width) + "x" + std::to_string(board.height) +
+        "x" + std::to_string(board.mines));
+    frame({{PRESS, MOUSE_LEFT, 1024 / 2 - 40, 768 / 2 + 22}});
+    frame({clickCell(board, board.width / 2, board.height / 2, MOUSE_LEFT)});
+}
+
+/**
+ * @brief Load Snake with a given length and start a game
+ *
+ * @param length The initial length of the snake
+ * @param grid The side of the square grid, 0 for the default one
+ */
+void BenchGame::startSnake(int length, int grid)
+{
+    if (grid > 0)
+        setenv("ARCADE_SNAKE_GRID",
+            (std::to_string(grid) + "x" + std::to_string(grid)).c_str(), 1);
+    load(SNAKE_LIB, "ARCADE_SNAKE_LENGTH", std::to_string(length));
+    unsetenv("ARCADE_SNAKE_GRID");
+    frame({{PRESS, MOUSE_LEFT, 1024 / 2, 768 / 2 + 10}});
+}
+
+/**
+ * @brief Run a frame of the game, BENCH_FRAME_DT seconds long, as the
+ * core does
+ *
+ * @param events The events of the frame
+ * @return std::size_t The number of entities rendered
+ */
+std::size_t BenchGame::frame(const std::vector<RawEvent> &events)
+{
+    int steps = _fixedStep.advance(BENCH_FRAME_DT);
+
+    _game->update(BENCH_FRAME_DT);
+    _game->handleEvent(events);
+    for (int i = 0; i < steps; i++)
+        _game->fixedUpdate(_fixedStep.getStep());
+    _game->setInterpolation(_fixedStep.getAlpha());
+    return _game->renderGame().size();
+}
+
+/**
+ * @brief Render the current state of the game
+ *
+ * @return std::map<std::string, Entity> The entities of the frame
+ */
+std::map<std::string, Entity> BenchGame::render(void)
+{
+    return _game->renderGame();
+}
+
+/**
+ * @brief Check if the game is over
+ *
+ * @return true if the game must be started again
+ */
+bool BenchGame::isGameOver(void)
+{
+    return _game->isGameOver();
+}
+
+/**
+ * @brief Get the screen position of the center of a Minesweeper cell
+ *
+ * Mirrors the layout of Minesweeper::handleClick.
+ *
+ * @param board The board
+ * @param x The column of the cell
+ * @param y The row of the cell
+ * @param button The mouse button
+ * @return RawEvent The click on the cell
+ */
+RawEvent BenchGame::clickCell(const MinesweeperBoard &board, int x, int y,
+    EventKey button)
+{
+    int cell = 768 / std::max(board.width, board.height);
+    int offsetX = 1024 - board.width * cell - 5;
+    int offsetY = (768 - board.height * cell) / 2;
+
+    return {PRESS, button, offsetX + x * cell + cell / 2,
+        offsetY + y * cell + cell / 2};
+}
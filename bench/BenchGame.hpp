@@ -0,0 +1,65 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** BenchGame
+*/
+
+#ifndef BENCHGAME_HPP_
+    #define BENCHGAME_HPP_
+
+    #include <memory>
+    #include <map>
+    #include <string>
+    #include <vector>
+
+    #include "../src/core/FixedTimestep.hpp"
+    #include "../src/core/LibLoader.hpp"
+
+    #define BENCH_SEED 42
+    // Time given to the games for each frame, so that runs are repeatable
+    #define BENCH_FRAME_DT (1.0 / 60)
+
+    #define MENU_LIB "./lib/arcade_menu.so"
+    #define MINESWEEPER_LIB "./lib/arcade_minesweeper.so"
+    #define SNAKE_LIB "./lib/arcade_snake.so"
+
+struct MinesweeperBoard {
+    int width;
+    int height;
+    int mines;
+};
+
+/**
+ * @brief A game loaded through the same loader as the core
+ *
+ * The start methods load a game and drive it from its own menu to the
+ * state measured by the benchmarks. The loader is declared first so that
+ * the library is closed after the game is destroyed.
+ */
+class BenchGame {
+    public:
+        BenchGame() = default;
+        ~BenchGame();
+
+        void startMenu(void);
+        void startMinesweeper(const MinesweeperBoard &board);
+        void startSnake(int length, int grid = 0);
+
+        std::size_t frame(const std::vector<RawEvent> &events);
+        std::map<std::string, Entity> render(void);
+        bool isGameOver(void);
+
+        static RawEvent clickCell(const MinesweeperBoard &board, int x, int y,
+            EventKey button);
+
+    private:
+        void load(const std::string &path, const char *env,
+            const std::string &value);
+
+        DLLoader<IGame> _loader{"GameEntryPoint"};
+        std::unique_ptr<IGame> _game;
+        FixedTimestep _fixedStep;
+};
+
+#endif /* !BENCHGAME_HPP_ */
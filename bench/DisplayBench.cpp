@@ -0,0 +1,251 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** DisplayBench
+*/
+
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <thread>
+
+#include "Bench.hpp"
+#include "BenchGame.hpp"
+
+#define PTY_COLUMNS 200
+#define PTY_ROWS 60
+
+/**
+ * @brief A frame of renderObjects, for the graphical and terminal sprites
+ */
+struct Workload {
+    std::string name;
+    std::vector<renderObject> objects[2];
+};
+
+/**
+ * @brief A display backend and how to run it offscreen
+ */
+struct Backend {
+    std::string name;
+    std::string path;
+    bool pty;
+};
+
+////////////////////////////////// Workloads //////////////////////////////////
+
+/**
+ * @brief Convert the entities of a frame as the core does
+ *
+ * The MUSIC entities are left out: they start a sound, which is not the
+ * drawing cost measured here.
+ *
+ * @param name The name of the workload
+ * @param entities The entities of the frame
+ * @return Workload The objects drawn for each display type
+ */
+static Workload makeWorkload(const std::string &name,
+    const std::map<std::string, Entity> &entities)
+{
+    Workload workload;
+
+    workload.name = name;
+    for (int dtype = GRAPHICAL; dtype <= TERMINAL; dtype++) {
+        for (const auto &pair : entities) {
+            const Entity &val = pair.second;
+            auto sprite = val.sprites.find(static_cast<DisplayType>(dtype));
+            if (val.type == MUSIC || sprite == val.sprites.end())
+                continue;
+            workload.objects[dtype].push_back({val.x, val.y, val.width,
+                val.height, val.rotate,
+                {val.RGB[0], val.RGB[1], val.RGB[2]}, val.type,
+                sprite->second});
+        }
+    }
+    return workload;
+}
+
+/**
+ * @brief Record the frames replayed on every backend
+ *
+ * @return std::vector<Workload> The recorded frames
+ */
+static std::vector<Workload> recordWorkloads(void)
+{
+    std::vector<Workload> workloads;
+    BenchGame game;
+
+    game.startMenu();
+    workloads.push_back(makeWorkload("menu", game.render()));
+    game.startMinesweeper({30, 16, 99});
+    workloads.push_back(makeWorkload("minesweeper-30x16", game.render()));
+    game.startMinesweeper({200, 200, 6000});
+    workloads.push_back(makeWorkload("minesweeper-200x200", game.render()));
+    game.startSnake(300);
+    workloads.push_back(makeWorkload("snake-300", game.render()));
+    game.startSnake(300, 256);
+    workloads.push_back(makeWorkload("snake-300-256x256", game.render()));
+    return workloads;
+}
+
+/////////////////////////////// Pseudo-terminal ///////////////////////////////
+
+/**
+ * @brief A pseudo-terminal standing for the terminal of Ncurses
+ *
+ * Ncurses reads stdin and writes to stderr, so both are redirected to the
+ * slave side while the display is alive. The master side is drained by a
+ * thread so that the writes of the display never block.
+ */
+class PseudoTerminal {
+    public:
+        PseudoTerminal()
+        {
+            struct winsize size = {PTY_ROWS, PTY_COLUMNS, 0, 0};
+
+            _master = posix_openpt(O_RDWR | O_NOCTTY);
+            if (_master < 0 || grantpt(_master) != 0 ||
+                unlockpt(_master) != 0)
+                throw std::runtime_error("Unable to open a pseudo-terminal");
+            _slave = open(ptsname(_master), O_RDWR | O_NOCTTY);
+            if (_slave < 0)
+                throw std::runtime_error("Unable to open the pty slave");
+            ioctl(_slave, TIOCSWINSZ, &size);
+            _stdin = dup(STDIN_FILENO);
+            _stderr = dup(STDERR_FILENO);
+            dup2(_slave, STDIN_FILENO);
+            dup2(_slave, STDERR_FILENO);
+            setenv("TERM", "xterm-256color", 0);
+            _drain = std::thread([this]() {
+                char buffer[4096];
+                while (_running && read(_master, buffer, sizeof(buffer)) > 0);
+            });
+        }
+
+        ~PseudoTerminal()
+        {
+            dup2(_stdin, STDIN_FILENO);
+            dup2(_stderr, STDERR_FILENO);
+            close(_stdin);
+            close(_stderr);
+            _running = false;
+            close(_slave);
+            _drain.join();
+            close(_master);
+        }
+
+    private:
+        int _master = -1;
+        int _slave = -1;
+        int _stdin = -1;
+        int _stderr = -1;
+        std::atomic<bool> _running{true};
+        std::thread _drain;
+};
+
+/////////////////////////////////// Backends //////////////////////////////////
+
+/**
+ * @brief Replay every workload on a backend
+ *
+ * A frame is clear, drawObject for every object and display, as in
+ * Core::renderEntities. The time of each call is reported apart.
+ *
+ * @param report The report to run the cases into
+ * @param backend The backend to measure
+ * @param workloads The recorded frames
+ */
+static void benchBackend(BenchReport &report, const Backend &backend,
+    const std::vector<Workload> &workloads)
+{
+    using Clock = std::chrono::steady_clock;
+    std::unique_ptr<PseudoTerminal> pty;
+    DLLoader<IDisplay> loader("DisplayEntryPoint");
+    std::unique_ptr<IDisplay> display;
+
+    if (backend.pty)
+        pty = std::make_unique<PseudoTerminal>();
+    display.reset(loader.getInstance(backend.path));
+    for (const Workload &workload : workloads) {
+        const std::vector<renderObject> &objects =
+            workload.objects[display->getDType()];
+        Clock::duration clear = Clock::duration::zero();
+        Clock::duration draw = Clock::duration::zero();
+        Clock::duration present = Clock::duration::zero();
+        std::uint64_t frames = 0;
+        auto frame = [&]() {
+            Clock::time_point start = Clock::now();
+            display->clear();
+            Clock::time_point drawStart = Clock::now();
+            for (const renderObject &object : objects)
+                display->drawObject(object);
+            Clock::time_point presentStart = Clock::now();
+            display->display();
+            present += Clock::now() - presentStart;
+            draw += presentStart - drawStart;
+            clear += drawStart - start;
+            frames++;
+            return objects.size();
+        };
+        auto finish = [&](BenchResult &result) {
+            auto mean = [&frames](Clock::duration total) {
+                return std::chrono::duration<double, std::nano>(total).count() /
+                    frames;
+            };
+            result.metrics = {{"clear_ns", mean(clear)},
+                {"draw_ns", mean(draw)}, {"display_ns", mean(present)},
+                {"draw_per_object_ns", mean(draw) / objects.size()}};
+        };
+        report.run({backend.name + "/" + workload.name,
+            {{"backend", backend.name}, {"workload", workload.name}},
+            []() {}, frame, nullptr, finish});
+    }
+    display.reset();
+}
+
+int main(int ac, char **av)
+{
+    BenchOptions options;
+    std::vector<Workload> workloads;
+    const std::vector<Backend> backends = {
+        {"null", "./bench/lib/arcade_null.so", false},
+        {"ncurses", "./lib/arcade_ncurses.so", true},
+        {"sdl2", "./lib/arcade_sdl2.so", false},
+        {"sfml", "./lib/arcade_sfml.so", false}};
+
+    if (!parseBenchOptions(ac, av, options)) {
+        std::cerr << "USAGE: " << av[0] << " [--frames n] [--seconds s] "
+                  << "[--out file] [--filter name]" << std::endl;
+        return 84;
+    }
+    setenv("SDL_VIDEODRIVER", "dummy", 0);
+    setenv("SDL_AUDIODRIVER", "dummy", 0);
+    setenv("ARCADE_SFML_OFFSCREEN", "1", 0);
+    BenchReport report("displays", options);
+    try {
+        workloads = recordWorkloads();
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 84;
+    }
+    for (const Backend &backend : backends) {
+        if (access(backend.path.c_str(), F_OK) != 0) {
+            std::cerr << backend.name << ": " << backend.path
+                      << " not built, skipped" << std::endl;
+            continue;
+        }
+        try {
+            benchBackend(report, backend, workloads);
+        } catch (const std::exception &e) {
+            std::cerr << backend.name << ": " << e.what() << std::endl;
+        }
+    }
+    return report.write() ? 0 : 84;
+}
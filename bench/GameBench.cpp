@@ -0,0 +1,222 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** GameBench
+*/
+
+#include <cstdint>
+#include <iostream>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+#include "Bench.hpp"
+#include "BenchGame.hpp"
+#include "../src/libs/game/MineSweeper/AdjacentMines.hpp"
+#include "../src/libs/game/SnakeArena/ArenaSimulation.hpp"
+#include "../src/libs/game/utils/Random.hpp"
+
+/**
+ * @brief Add the cases of a Minesweeper board
+ *
+ * The game is started from its menu and the center cell is revealed, then
+ * "idle" renders the board without input and "flag" cycles the flag of a
+ * corner cell every frame.
+ *
+ * @param report The report to run the cases into
+ * @param game The game instance shared by the cases
+ * @param board The board to play on
+ */
+static void benchMinesweeper(BenchReport &report, BenchGame &game,
+    const MinesweeperBoard &board)
+{
+    std::string size = std::to_string(board.width) + "x" +
+        std::to_string(board.height);
+    std::string name = "minesweeper/" + size;
+    RawEvent flag = BenchGame::clickCell(board, 0, 0, MOUSE_RIGHT);
+    auto setup = [&game, board]() { game.startMinesweeper(board); };
+    auto isDone = [&game]() { return game.isGameOver(); };
+    std::vector<std::pair<std::string, std::string>> params = {
+        {"board", size}, {"mines", std::to_string(board.mines)}};
+
+    report.run({name + "/idle", params, setup,
+        [&game]() { return game.frame({}); }, isDone, nullptr});
+    report.run({name + "/flag", params, setup,
+        [&game, flag]() { return game.frame({flag}); }, isDone, nullptr});
+}
+
+/**
+ * @brief Add the case of a Snake of a given length
+ *
+ * The game is started from its menu and runs without input; it is
+ * restarted, untimed, whenever the snake dies.
+ *
+ * @param report The report to run the case into
+ * @param game The game instance
+ * @param length The initial length of the snake
+ * @param grid The side of the square grid, 0 for the default one
+ */
+static void benchSnake(BenchReport &report, BenchGame &game, int length,
+    int grid = 0)
+{
+    std::string name = "snake/length-" + std::to_string(length);
+    std::vector<std::pair<std::string, std::string>> params = {
+        {"length", std::to_string(length)}};
+
+    if (grid > 0) {
+        name += "/grid-" + std::to_string(grid);
+        params.push_back({"grid", std::to_string(grid)});
+    }
+    report.run({name, params,
+        [&game, length, grid]() { game.startSnake(length, grid); },
+        [&game]() { return game.frame({}); },
+        [&game]() { return game.isGameOver(); }, nullptr});
+}
+
+/**
+ * @brief Add the cases of the adjacent mine count of a board
+ *
+ * The board is filled with 20% of mines, then every implementation the
+ * CPU supports counts the neighbours of all the cells each frame. Their
+ * counts are checked against the scalar ones.
+ *
+ * @param report The report to run the cases into
+ * @param width The width of the board
+ * @param height The height of the board
+ */
+static void benchAdjacency(BenchReport &report, int width, int height)
+{
+    std::string size = std::to_string(width) + "x" + std::to_string(height);
+    std::vector<std::uint8_t> plane((width + 2) * (height + 2), 0);
+    std::vector<std::uint8_t> expected(width * height);
+    std::vector<std::uint8_t> counts(width * height);
+    Random random(BENCH_SEED);
+    const std::vector<std::pair<std::string, AdjacentMinesFunction>> paths = {
+        {"scalar", countAdjacentMinesScalar},
+        {"sse2", hasAdjacentMinesSse2() ? countAdjacentMinesSse2 : nullptr},
+        {"avx2", hasAdjacentMinesAvx2() ? countAdjacentMinesAvx2 : nullptr}};
+
+    for (int y = 1; y <= height; y++) {
+        for (int x = 1; x <= width; x++)
+            plane[y * (width + 2) + x] = random.below(5) == 0;
+    }
+    countAdjacentMinesScalar(plane.data(), width, height, expected.data());
+    for (const auto &[path, count] : paths) {
+        if (!count)
+            continue;
+        report.run({"adjacency/" + path + "/" + size,
+            {{"board", size}, {"path", path}}, []() {},
+            [&, count]() {
+                count(plane.data(), width, height, counts.data());
+                return counts.size();
+            }, nullptr, nullptr});
+        if (report.isSelected("adjacency/" + path + "/" + size) &&
+            counts != expected)
+            throw std::runtime_error("adjacency/" + path + ": wrong counts");
+    }
+}
+
+/**
+ * @brief Add the cases of the Snake arena simulation, one per thread count
+ *
+ * Each case only runs ticks, the rendering is measured by the games. The
+ * thread counts double from 1 up to the number of cores, 2 at least. The
+ * speedup of each count over a single thread is reported, and every count
+ * must give the same arena as a single thread after the same ticks. When
+ * the single thread case is filtered out, it is still timed, unreported,
+ * as the reference of the speedups.
+ *
+ * @param report The report to run the cases into
+ * @param size The side of the arena
+ * @param snakes The number of snakes
+ */
+static void benchArena(BenchReport &report, int size, int snakes)
+{
+    std::string name = "arena/" + std::to_string(size) + "x" +
+        std::to_string(size) + "-" + std::to_string(snakes);
+    std::size_t cores = std::max(2u, std::thread::hardware_concurrency());
+    ArenaConfig config = {size, size, snakes, 1, BENCH_SEED};
+    const ArenaConfig singleConfig = config;
+    std::unique_ptr<ArenaSimulation> arena;
+    std::uint64_t expected = 0;
+    double single = 0;
+
+    for (std::size_t threads = 1; threads <= cores; threads *= 2) {
+        std::string caseName = name + "/threads-" + std::to_string(threads);
+        if (!report.isSelected(caseName))
+            continue;
+        config.threads = threads;
+        arena = std::make_unique<ArenaSimulation>(config);
+        for (int i = 0; i < 100; i++)
+            arena->tick();
+        if (expected == 0 && threads > 1) {
+            ArenaSimulation reference(singleConfig);
+            for (int i = 0; i < 100; i++)
+                reference.tick();
+            expected = reference.getChecksum();
+        }
+        if (expected == 0)
+            expected = arena->getChecksum();
+        if (arena->getChecksum() != expected)
+            throw std::runtime_error(name + ": " + std::to_string(threads) +
+                " threads diverge from a single one");
+        if (single == 0 && threads > 1) {
+            std::unique_ptr<ArenaSimulation> reference;
+            single = report.measure({name + "/threads-1", {},
+                [&reference, singleConfig]() {
+                    reference = std::make_unique<ArenaSimulation>(singleConfig);
+                },
+                [&reference, snakes]() {
+                    reference->tick();
+                    return static_cast<std::size_t>(snakes);
+                }, nullptr, nullptr}).mean;
+        }
+        report.run({caseName,
+            {{"grid", std::to_string(size)},
+            {"snakes", std::to_string(snakes)},
+            {"threads", std::to_string(threads)}},
+            [&arena, config]() {
+                arena = std::make_unique<ArenaSimulation>(config);
+            },
+            [&arena, snakes]() {
+                arena->tick();
+                return static_cast<std::size_t>(snakes);
+            }, nullptr,
+            [&single](BenchResult &result) {
+                if (single == 0)
+                    single = result.mean;
+                result.metrics = {{"ticks_per_second", 1e9 / result.mean},
+                    {"speedup", single / result.mean}};
+            }});
+    }
+}
+
+int main(int ac, char **av)
+{
+    BenchOptions options;
+    BenchGame game;
+
+    if (!parseBenchOptions(ac, av, options)) {
+        std::cerr << "USAGE: " << av[0] << " [--frames n] [--seconds s] "
+                  << "[--out file] [--filter name]" << std::endl;
+        return 84;
+    }
+    BenchReport report("games", options);
+    try {
+        benchMinesweeper(report, game, {16, 16, 40});
+        benchMinesweeper(report, game, {30, 16, 99});
+        benchMinesweeper(report, game, {200, 200, 6000});
+        benchSnake(report, game, 4);
+        benchSnake(report, game, 300);
+        benchSnake(report, game, 300, 256);
+        benchAdjacency(report, 30, 16);
+        benchAdjacency(report, 512, 512);
+        benchArena(report, 256, 64);
+    } catch (const std::exception &e) {
+        std::cerr << e.what() << std::endl;
+        return 84;
+    }
+    return report.write() ? 0 : 84;
+}
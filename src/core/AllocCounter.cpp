@@ -0,0 +1,161 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** AllocCounter
+*/
+
+#include "AllocCounter.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+static std::atomic<std::uint64_t> allocCount{0};
+static std::atomic<std::uint64_t> allocBytes{0};
+
+static std::atomic<bool> allocTracking{false};
+static std::atomic<std::uint64_t> phaseCount[ALLOC_PHASE_COUNT];
+static std::atomic<std::uint64_t> phaseBytes[ALLOC_PHASE_COUNT];
+static thread_local AllocPhase currentPhase = ALLOC_CORE;
+
+/**
+ * @brief Get the number of allocations made since the start
+ *
+ * @return std::uint64_t The number of calls to operator new
+ */
+std::uint64_t AllocCounter::getCount(void)
+{
+    return allocCount.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of bytes allocated since the start
+ *
+ * @return std::uint64_t The number of bytes requested to operator new
+ */
+std::uint64_t AllocCounter::getBytes(void)
+{
+    return allocBytes.load(std::memory_order_relaxed);
+}
+
+//------------------------------- Phases -------------------------------//
+
+/**
+ * @brief Enter a phase until the end of the scope
+ *
+ * @param phase The phase the allocations of the scope are attributed to
+ */
+AllocCounter::Phase::Phase(AllocPhase phase) : _previous(currentPhase)
+{
+    currentPhase = phase;
+}
+
+/**
+ * @brief Go back to the phase the scope was entered from
+ */
+AllocCounter::Phase::~Phase()
+{
+    currentPhase = _previous;
+}
+
+/**
+ * @brief Enable or disable the attribution of the allocations to phases
+ *
+ * @param tracking true to attribute the allocations
+ */
+void AllocCounter::setTracking(bool tracking)
+{
+    allocTracking.store(tracking, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Check if the allocations are attributed to phases
+ *
+ * @return true if tracking is enabled
+ */
+bool AllocCounter::isTracking(void)
+{
+    return allocTracking.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of allocations attributed to a phase
+ *
+ * @param phase The phase
+ * @return std::uint64_t The number of allocations since tracking started
+ */
+std::uint64_t AllocCounter::getPhaseCount(AllocPhase phase)
+{
+    return phaseCount[phase].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of bytes attributed to a phase
+ *
+ * @param phase The phase
+ * @return std::uint64_t The number of bytes since tracking started
+ */
+std::uint64_t AllocCounter::getPhaseBytes(AllocPhase phase)
+{
+    return phaseBytes[phase].load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the name of a phase, as written in the profiling output
+ *
+ * @param phase The phase
+ * @return const char* The name of the phase
+ */
+const char *AllocCounter::getPhaseName(AllocPhase phase)
+{
+    static const char *names[ALLOC_PHASE_COUNT] = {"core", "update",
+        "handle_event", "render_game", "draw_object", "display"};
+
+    return names[phase];
+}
+
+///////////////////////////// Global Replacements /////////////////////////////
+
+/**
+ * @brief Counting replacement of the global operator new
+ *
+ * The array and nothrow forms of the standard library forward to this one.
+ *
+ * @param size The number of bytes to allocate
+ * @return void* The allocated memory
+ */
+void *operator new(std::size_t size)
+{
+    void *ptr = std::malloc(size ? size : 1);
+
+    if (!ptr)
+        throw std::bad_alloc();
+    allocCount.fetch_add(1, std::memory_order_relaxed);
+    allocBytes.fetch_add(size, std::memory_order_relaxed);
+    if (allocTracking.load(std::memory_order_relaxed)) {
+        phaseCount[currentPhase].fetch_add(1, std::memory_order_relaxed);
+        phaseBytes[currentPhase].fetch_add(size, std::memory_order_relaxed);
+    }
+    return ptr;
+}
+
+/**
+ * @brief Replacement of the global operator delete matching operator new
+ *
+ * @param ptr The memory to release
+ */
+void operator delete(void *ptr) noexcept
+{
+    std::free(ptr);
+}
+
+/**
+ * @brief Sized replacement of the global operator delete
+ *
+ * @param ptr The memory to release
+ */
+void operator delete(void *ptr, std::size_t) noexcept
+{
+    std::free(ptr);
+}
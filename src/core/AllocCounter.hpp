@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** AllocCounter
+*/
+
+#ifndef ALLOCCOUNTER_HPP_
+    #define ALLOCCOUNTER_HPP_
+
+    #include <cstdint>
+
+/**
+ * @brief Part of the frame an allocation is attributed to
+ */
+enum AllocPhase {
+    ALLOC_CORE,
+    ALLOC_UPDATE,
+    ALLOC_HANDLE_EVENT,
+    ALLOC_RENDER_GAME,
+    ALLOC_DRAW_OBJECT,
+    ALLOC_DISPLAY,
+    ALLOC_PHASE_COUNT
+};
+
+/**
+ * @brief Process-wide heap allocation counters
+ *
+ * The core replaces the global operator new and operator delete. Since
+ * the core is linked with -rdynamic, the allocations made by the loaded
+ * game and display libraries are counted as well.
+ *
+ * When tracking is enabled, each allocation is also attributed to the
+ * phase the calling thread is in, which the core sets around the calls
+ * into the libraries. Other threads stay in ALLOC_CORE.
+ */
+class AllocCounter {
+    public:
+        /**
+         * @brief Attributes the allocations of a scope to a phase
+         */
+        class Phase {
+            public:
+                explicit Phase(AllocPhase phase);
+                ~Phase();
+
+            private:
+                AllocPhase _previous;
+        };
+
+        static std::uint64_t getCount(void);
+        static std::uint64_t getBytes(void);
+
+        static void setTracking(bool tracking);
+        static bool isTracking(void);
+        static std::uint64_t getPhaseCount(AllocPhase phase);
+        static std::uint64_t getPhaseBytes(AllocPhase phase);
+        static const char *getPhaseName(AllocPhase phase);
+};
+
+#endif /* !ALLOCCOUNTER_HPP_ */
@@ -7,26 +7,37 @@
 
 #include "Core.hpp"
 
+#include <algorithm>
 #include <filesystem>
 #include <fstream>
 
 #include "LibLoader.hpp"
+#include "../interfaces/Trace.hpp"
 
 ///////////////////////// Constructor and Destructor /////////////////////////
 
 /**
  * @brief Constructor for the Core class.
  * @param path The path to the initial display library.
+ * @param options The options given on the command line.
  */
-Core::Core(std::string path)
+Core::Core(std::string path, CoreOptions options) : _options(options)
 {
+    Tracer::getInstance().setEnabled(!_options.traceOut.empty());
+    AllocCounter::setTracking(_options.allocTrack);
     LibGetter libGetter = LibGetter();
 
+    if (!openSession()) {
+        _running = false;
+        _hasFailed = true;
+        return;
+    }
     _displayLibs = libGetter.getDisplayLibs();
     _gameLibs = libGetter.getGameLibs();
     if (load_display(path) != 0) {
         std::cerr << "Error loading display library" << std::endl;
         _running = false;
+        _hasFailed = true;
         return;
     }
     if (load_game("./lib/arcade_menu.so") == 1) {
@@ -38,9 +49,140 @@ Core::Core(std::string path)
 
 /**
  * @brief Destructor for the Core class.
+ * Dumps the profiling data and the trace if output files were requested.
  */
 Core::~Core()
 {
+    if (!_options.profileOut.empty())
+        _profiler.dump(_options.profileOut);
+    if (!_options.traceOut.empty())
+        Tracer::getInstance().write(_options.traceOut);
+}
+
+///////////////////////////// Record and Replay /////////////////////////////
+
+/**
+ * @brief Opens the record and replay files given on the command line and
+ * picks the seed of the session.
+ * The seed is the one given with --seed, else the one of the replayed
+ * session, else a random one. It is stored in the record file so that a
+ * replay gives the games the same random sequences.
+ * @return true on success, false if one of the files cannot be used.
+ */
+bool Core::openSession(void)
+{
+    _sessionStart = std::chrono::steady_clock::now();
+    _frameTimestamp = 0;
+    if (!_options.replayPath.empty() &&
+        !_replayer.open(_options.replayPath)) {
+        return false;
+    }
+    if (_options.hasSeed)
+        _seed = _options.seed;
+    else if (_replayer.isOpen())
+        _seed = _replayer.getSeed();
+    else
+        _seed = (static_cast<std::uint64_t>(std::random_device{}()) << 32) |
+            std::random_device{}();
+    if (!_options.recordPath.empty() &&
+        !_recorder.open(_options.recordPath, _seed)) {
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Polls the events of the current frame.
+ * When replaying, the display is still polled to keep it responsive, but
+ * only its quit requests are kept and the recorded events are fed
+ * instead. A QUIT event is sent once the replay is over. When recording,
+ * the batch is written with its frame number and timestamp.
+ * The time since the previous frame is kept for IGame::update; a replay
+ * takes it from the recorded timestamps so that the timers of the games
+ * follow the recorded session. The timestamps of the events are made
+ * relative to the start of the session, like the ones of the frames.
+ * @return The events of the frame.
+ */
+std::vector<RawEvent> Core::pollEvents(void)
+{
+    std::vector<RawEvent> events;
+    std::uint64_t timestamp = std::chrono::duration_cast<
+        std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        _sessionStart).count();
+    std::uint64_t start = std::chrono::duration_cast<
+        std::chrono::microseconds>(_sessionStart.time_since_epoch()).count();
+
+    {
+        AllocCounter::Phase phase(ALLOC_DISPLAY);
+        events = _display->pollEvent();
+    }
+    for (RawEvent &event : events) {
+        event.timestamp = event.timestamp > start ?
+            std::min(event.timestamp - start, timestamp) : timestamp;
+    }
+
+    if (_replayer.isOpen()) {
+        bool quit = checkQuit(events);
+        bool isOver = !_replayer.next(_frame, events);
+        timestamp = std::max(_replayer.getTimestamp(), _frameTimestamp);
+        if (isOver || quit) {
+            events.push_back({QUIT, MOUSE_LEFT, 0, 0, timestamp});
+        }
+    }
+    _recorder.record(_frame, timestamp, events);
+    _frameDelta = (timestamp - _frameTimestamp) / 1000000.0;
+    _frameTimestamp = timestamp;
+    _frame++;
+    return events;
+}
+
+/**
+ * @brief Runs the game for the current frame.
+ * The game gets the time of the frame, then its events, then as many fixed
+ * steps as the time of the frames completed, and last the share of a step
+ * left over to interpolate its rendering with. The update, the events and
+ * the fixed steps are each timed as their own profiler stage.
+ * @param events The events of the frame.
+ */
+void Core::tickGame(const std::vector<RawEvent> &events)
+{
+    int steps = _fixedStep.advance(_frameDelta);
+
+    {
+        Profiler::Scope scope(_profiler, STAGE_UPDATE);
+        AllocCounter::Phase phase(ALLOC_UPDATE);
+        _game->update(_frameDelta);
+    }
+    {
+        Profiler::Scope scope(_profiler, STAGE_HANDLE_EVENT);
+        AllocCounter::Phase phase(ALLOC_HANDLE_EVENT);
+        _game->handleEvent(events);
+    }
+    Profiler::Scope scope(_profiler, STAGE_FIXED_UPDATE);
+    AllocCounter::Phase phase(ALLOC_UPDATE);
+    for (int i = 0; i < steps; i++)
+        _game->fixedUpdate(_fixedStep.getStep());
+    _game->setInterpolation(_fixedStep.getAlpha());
+}
+
+/**
+ * @brief Records the time from each press of the frame to its display.
+ * Replayed events are skipped, their timestamps are not of this session.
+ * @param events The events of the frame.
+ */
+void Core::recordInputLatency(const std::vector<RawEvent> &events)
+{
+    std::uint64_t now = std::chrono::duration_cast<
+        std::chrono::microseconds>(std::chrono::steady_clock::now() -
+        _sessionStart).count();
+
+    if (_replayer.isOpen())
+        return;
+    for (const RawEvent &event : events) {
+        if (event.type == PRESS && event.timestamp <= now)
+            _profiler.record(STAGE_INPUT_LATENCY,
+                (now - event.timestamp) * 1000);
+    }
 }
 
 /////////////////////////////// Emergency Menu ///////////////////////////////
@@ -59,13 +201,15 @@ void Core::startEmergencyMenu(void)
     std::string newGamePath;
 
     _game = std::make_unique<EmergencyMenu>();
+    _game->setSeed(_seed);
+    _fixedStep.reset();
     while (!gameSelected && _running) {
-        std::vector<RawEvent> events = _display->pollEvent();
+        std::vector<RawEvent> events = pollEvents();
         if (checkQuit(events)) {
             _running = false;
             break;
         }
-        _game->handleEvent(events);
+        tickGame(events);
         entities = _game->renderGame();
         renderEntities(entities);
         if (_game->isGameEnd()) {
@@ -85,6 +229,7 @@ void Core::startEmergencyMenu(void)
                 std::cerr << "Failed to load selected game: " << newGamePath
                           << std::endl;
                 _game = std::make_unique<EmergencyMenu>();
+                _game->setSeed(_seed);
             }
         }
     }
@@ -260,7 +405,6 @@ void Core::reloadGameLibrary(void)
     if (load_game(_currentGamePath) == 1) {
         std::cerr << "Failed to reload game library: " << _currentGamePath
                   << std::endl;
-        startEmergencyMenu();
     }
 }
 
@@ -328,15 +472,50 @@ bool Core::checkGoToMenu(std::vector<RawEvent> events)
 /**
  * @brief Switches to the menu game.
  * This function deletes the current game library and loads the menu game
- * library. If it fails to load the menu game, it starts the emergency
- * menu.
+ * library. If it fails to load the menu game, the main loop starts the
+ * emergency menu.
  */
 void Core::goToMenu(void)
 {
     delete_game();
     if (load_game("./lib/arcade_menu.so") == 1) {
         std::cerr << "Failed to load menu game" << std::endl;
-        startEmergencyMenu();
+    }
+}
+
+///////////////////////////// Profiling Hot Keys /////////////////////////////
+
+/**
+ * @brief Toggles the profiler overlay when PROFILER_OVERLAY_KEY is pressed.
+ * @param events The vector of RawEvent objects to check.
+ */
+void Core::profilerToggling(std::vector<RawEvent> events)
+{
+    for (auto it = events.begin(); it != events.end();) {
+        if (it->type == PRESS && it->key == PROFILER_OVERLAY_KEY) {
+            _profiler.toggleOverlay();
+            it = events.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+/**
+ * @brief Writes the trace recorded so far when TRACE_DUMP_KEY is pressed.
+ * The trace is written to the --trace-out file, tracing goes on afterwards.
+ * @param events The vector of RawEvent objects to check.
+ */
+void Core::traceDumping(std::vector<RawEvent> events)
+{
+    for (auto it = events.begin(); it != events.end();) {
+        if (it->type == PRESS && it->key == TRACE_DUMP_KEY &&
+            !_options.traceOut.empty()) {
+            Tracer::getInstance().write(_options.traceOut);
+            it = events.erase(it);
+        } else {
+            ++it;
+        }
     }
 }
 
@@ -344,30 +523,43 @@ void Core::goToMenu(void)
 
 /**
  * @brief Renders the entities on the display.
+ * The allocations of clear and display are attributed to the display, the
+ * ones of drawObject to drawObject and the conversion to the core.
  * @param entities A map of entity names to Entity objects to render.
  */
-void Core::renderEntities(std::map<std::string, Entity> entities)
+void Core::renderEntities(const std::map<std::string, Entity> &entities)
 {
     if (entities.size() > 0) {
-        _display->clear();
-        for (const auto &pair : entities) {
-            Entity val = pair.second;
-            renderObject obj;
-            obj.x = val.x;
-            obj.y = val.y;
-            obj.type = val.type;
-            obj.width = val.width;
-            obj.height = val.height;
-            obj.rotate = val.rotate;
-            if (val.sprites.find(_display->getDType()) == val.sprites.end()) {
-                continue;
+        DisplayType displayType = _display->getDType();
+        {
+            Profiler::Scope scope(_profiler, STAGE_RENDER_ENTITIES);
+            {
+                AllocCounter::Phase phase(ALLOC_DISPLAY);
+                _display->clear();
+            }
+            for (const auto &pair : entities) {
+                const Entity &val = pair.second;
+                auto sprite = val.sprites.find(displayType);
+                if (sprite == val.sprites.end()) {
+                    continue;
+                }
+                renderObject obj;
+                obj.x = val.x;
+                obj.y = val.y;
+                obj.type = val.type;
+                obj.width = val.width;
+                obj.height = val.height;
+                obj.rotate = val.rotate;
+                obj.sprite = sprite->second;
+                obj.RGB[0] = val.RGB[0];
+                obj.RGB[1] = val.RGB[1];
+                obj.RGB[2] = val.RGB[2];
+                AllocCounter::Phase phase(ALLOC_DRAW_OBJECT);
+                _display->drawObject(obj);
             }
-            obj.sprite = val.sprites.find(_display->getDType())->second;
-            obj.RGB[0] = val.RGB[0];
-            obj.RGB[1] = val.RGB[1];
-            obj.RGB[2] = val.RGB[2];
-            _display->drawObject(obj);
         }
+        Profiler::Scope scope(_profiler, STAGE_DISPLAY);
+        AllocCounter::Phase phase(ALLOC_DISPLAY);
         _display->display();
     }
 }
@@ -379,6 +571,7 @@ void Core::renderEntities(std::map<std::string, Entity> entities)
  */
 void Core::handleScore(void)
 {
+    TraceScope trace("Core::handleScore");
     auto score = _game->getScore();
     ScoreManager scoreManager;
 
@@ -388,13 +581,30 @@ void Core::handleScore(void)
     scoreManager.saveScore(_game->getName(), score);
 }
 
+/**
+ * @brief Tells if the core failed to start.
+ * Set by the constructor when the record or replay file or the display
+ * library cannot be opened; quitting from the emergency menu is not a
+ * failure.
+ * @return true if the core cannot run, false otherwise.
+ */
+bool Core::hasFailed(void) const
+{
+    return _hasFailed;
+}
+
 /**
  * @brief Main loop of the Core class. Handles game logic, events, and
  * rendering.
+ *
+ * A game that failed to load leaves no game: the frame is then discarded
+ * and the emergency menu runs outside of it, so that the frames of the
+ * profiler and the trace stay balanced.
  */
 void Core::run()
 {
     while (_running) {
+        Profiler::Frame frame(_profiler);
         if (_game->isGameOver() == true) {
             handleScore();
         }
@@ -414,22 +624,47 @@ void Core::run()
             if (load_game(newLib) == 1) {
                 std::cerr << "Failed to load selected game: " << newLib
                           << std::endl;
+                frame.discard();
                 startEmergencyMenu();
+                continue;
             }
         }
-        std::vector<RawEvent> events = _display->pollEvent();
+        std::vector<RawEvent> events;
+        {
+            Profiler::Scope scope(_profiler, STAGE_POLL_EVENT);
+            events = pollEvents();
+        }
         if (checkQuit(events)) {
             _running = false;
             break;
         }
-        if (checkGoToMenu(events))
-            goToMenu();
-        displayLibrarySwitching(events);
-        gameLibrarySwitching(events);
-        libraryReloading(events);
-        _game->handleEvent(events);
-        std::map<std::string, Entity> entities = _game->renderGame();
+        {
+            Profiler::Scope scope(_profiler, STAGE_HOT_KEYS);
+            if (checkGoToMenu(events))
+                goToMenu();
+            displayLibrarySwitching(events);
+            gameLibrarySwitching(events);
+            libraryReloading(events);
+            profilerToggling(events);
+            traceDumping(events);
+        }
+        if (!_game) {
+            frame.discard();
+            startEmergencyMenu();
+            continue;
+        }
+        tickGame(events);
+        std::map<std::string, Entity> entities;
+        {
+            Profiler::Scope scope(_profiler, STAGE_RENDER_GAME);
+            AllocCounter::Phase phase(ALLOC_RENDER_GAME);
+            entities = _game->renderGame();
+        }
+        std::size_t entityCount = entities.size();
+        _profiler.addOverlay(entities);
         renderEntities(entities);
+        recordInputLatency(events);
+        frame.end(entityCount);
     }
 }
 
@@ -442,6 +677,8 @@ void Core::run()
  */
 int Core::load_display(std::string path)
 {
+    TraceScope trace("Core::load_display");
+
     try {
         _graphicLoader = DLLoader<IDisplay>("DisplayEntryPoint");
         _display = std::unique_ptr<IDisplay>(_graphicLoader.getInstance(path));
@@ -462,12 +699,16 @@ int Core::load_display(std::string path)
  */
 int Core::load_game(std::string path)
 {
+    TraceScope trace("Core::load_game");
+
     try {
         _gameLoader = DLLoader<IGame>("GameEntryPoint");
         _game = std::unique_ptr<IGame>(_gameLoader.getInstance(path));
         _currentGamePath = path;
         _selectedGameLib = getGameLibIndexFromPath(path);
         _game->setUsername(_username);
+        _game->setSeed(_seed);
+        _fixedStep.reset();
         return 0;
     } catch (const std::exception &e) {
         std::cerr << "Error loading game library: " << e.what() << std::endl;
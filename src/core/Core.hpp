@@ -10,16 +10,22 @@
 
     #include <dlfcn.h>
 
+    #include <chrono>
     #include <filesystem>
     #include <iostream>
     #include <memory>
+    #include <random>
     #include <vector>
 
     #include "../interfaces/IType.hpp"
     #include "../libs/display/interfaces/IDisplay.hpp"
     #include "../libs/game/interfaces/IGame.hpp"
     #include "./EmergencyMenu.hpp"
+    #include "FixedTimestep.hpp"
+    #include "InputRecorder.hpp"
     #include "LibLoader.hpp"
+    #include "Profiler.hpp"
+    #include "Tracer.hpp"
     #include "ScoreManager.hpp"
 
     #define PREVIOUS_DISPLAY_KEY KEYBOARD_F3
@@ -31,13 +37,26 @@
     #define NEXT_GAME_KEY KEYBOARD_F9
     #define GO_TO_MENU_KEY KEYBOARD_F10
     #define QUIT_KEY KEYBOARD_F11
+    #define PROFILER_OVERLAY_KEY KEYBOARD_INSERT
+    #define TRACE_DUMP_KEY KEYBOARD_HOME
+
+struct CoreOptions {
+    std::string profileOut;
+    std::string traceOut;
+    std::string recordPath;
+    std::string replayPath;
+    bool hasSeed = false;
+    std::uint64_t seed = 0;
+    bool allocTrack = false;
+};
 
 class Core {
     public:
-        Core(std::string path);
+        Core(std::string path, CoreOptions options = CoreOptions());
         ~Core();
 
         void run(void);
+        bool hasFailed(void) const;
 
     protected:
     private:
@@ -50,8 +69,12 @@ class Core {
         void startEmergencyMenu(void);
 
         bool checkQuit(std::vector<RawEvent> events);
+        std::vector<RawEvent> pollEvents(void);
+        void tickGame(const std::vector<RawEvent> &events);
+        void recordInputLatency(const std::vector<RawEvent> &events);
+        bool openSession(void);
 
-        void renderEntities(std::map<std::string, Entity> entities);
+        void renderEntities(const std::map<std::string, Entity> &entities);
         void handleScore(void);
 
         void nextDisplayLibrary(void);
@@ -75,11 +98,15 @@ class Core {
         bool checkGoToMenu(std::vector<RawEvent> events);
         void goToMenu(void);
 
+        void profilerToggling(std::vector<RawEvent> events);
+        void traceDumping(std::vector<RawEvent> events);
+
         DLLoader<IGame> _gameLoader;
         DLLoader<IDisplay> _graphicLoader;
         std::unique_ptr<IDisplay> _display;
         std::unique_ptr<IGame> _game;
         bool _running = true;
+        bool _hasFailed = false;
         std::vector<LibInfo> _displayLibs;
         std::vector<LibInfo> _gameLibs;
         size_t _selectedDisplayLib = 0;
@@ -87,6 +114,16 @@ class Core {
         std::string _currentGamePath = "";
         std::string _currentDisplayPath = "";
         std::string _username = "Username";
+        CoreOptions _options;
+        Profiler _profiler;
+        InputRecorder _recorder;
+        InputReplayer _replayer;
+        std::uint64_t _seed = 0;
+        std::uint64_t _frame = 0;
+        std::chrono::steady_clock::time_point _sessionStart;
+        std::uint64_t _frameTimestamp = 0;
+        double _frameDelta = 0;
+        FixedTimestep _fixedStep;
 };
 
 #endif /* !CORE_HPP_ */
@@ -109,6 +109,18 @@ void EmergencyMenu::setUsername(std::string username)
     (void)username;
 }
 
+/**
+ * @brief Set the seed of the random generator
+ *
+ * The emergency menu does not use randomness.
+ *
+ * @param seed The seed to use
+ */
+void EmergencyMenu::setSeed(std::uint64_t seed)
+{
+    (void)seed;
+}
+
 ////////////////////////////// Event Handling ///////////////////////////////
 
 /**
@@ -229,6 +241,38 @@ void EmergencyMenu::handleOneEvent(RawEvent event)
         handleEnter();
 }
 
+/**
+ * @brief Advance the time of the menu
+ *
+ * The emergency menu has no timer, so the time is unused.
+ *
+ * @param dt The time elapsed since the previous frame, in seconds
+ */
+void EmergencyMenu::update(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The menu has no simulation to step
+ *
+ * @param dt The duration of the step, in seconds
+ */
+void EmergencyMenu::fixedUpdate(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The menu has no motion to interpolate
+ *
+ * @param alpha The share of a step since the last one
+ */
+void EmergencyMenu::setInterpolation(double alpha)
+{
+    (void) alpha;
+}
+
 /**
  * @brief Handle events
  *
@@ -60,9 +60,13 @@ class EmergencyMenu : public IGame {
         std::string getNewDisplay(void) final;
 
         void handleEvent(std::vector<RawEvent>) final;
+        void update(double dt) final;
+        void fixedUpdate(double dt) final;
+        void setInterpolation(double alpha) final;
 
         std::string getName(void) final;
         void setUsername(std::string username) final;
+        void setSeed(std::uint64_t seed) final;
 
         std::map<IGame::EntityName, Entity> renderGame() final;
 
@@ -0,0 +1,68 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** FixedTimestep
+*/
+
+#include "FixedTimestep.hpp"
+
+/**
+ * @brief Construct a new FixedTimestep object
+ *
+ * @param step The duration of a step in seconds
+ * @param maxSteps The maximum number of steps run in a frame
+ */
+FixedTimestep::FixedTimestep(double step, int maxSteps)
+    : _step(step), _maxSteps(maxSteps)
+{
+}
+
+/**
+ * @brief Add the time of a frame and count the steps it completes
+ *
+ * @param dt The time of the frame in seconds, ignored if negative
+ * @return int The number of steps to run this frame
+ */
+int FixedTimestep::advance(double dt)
+{
+    int steps = 0;
+
+    if (dt > 0)
+        _accumulator += dt;
+    while (_accumulator >= _step && steps < _maxSteps) {
+        _accumulator -= _step;
+        steps++;
+    }
+    if (_accumulator >= _step)
+        _accumulator = 0;
+    return steps;
+}
+
+/**
+ * @brief Drop the time carried to the next frame, when a game is loaded
+ */
+void FixedTimestep::reset(void)
+{
+    _accumulator = 0;
+}
+
+/**
+ * @brief Get the duration of a step
+ *
+ * @return double The duration in seconds
+ */
+double FixedTimestep::getStep(void) const
+{
+    return _step;
+}
+
+/**
+ * @brief Get the share of a step carried to the next frame
+ *
+ * @return double The interpolation alpha, in [0, 1)
+ */
+double FixedTimestep::getAlpha(void) const
+{
+    return _accumulator / _step;
+}
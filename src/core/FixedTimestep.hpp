@@ -0,0 +1,43 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** FixedTimestep
+*/
+
+#ifndef FIXEDTIMESTEP_HPP_
+    #define FIXEDTIMESTEP_HPP_
+
+    // Rate of the fixed steps given to IGame::fixedUpdate, in steps per second
+    #define FIXED_STEP_RATE 120
+    #define FIXED_STEP_DT (1.0 / FIXED_STEP_RATE)
+    // Steps run at most in a frame, the time left over is dropped so that a
+    // slow frame does not make the next ones slower
+    #define FIXED_STEP_MAX 8
+
+/**
+ * @brief Turns the variable time of the frames into a number of fixed steps
+ *
+ * The time of a frame is accumulated, every full step of it is run and
+ * the rest is carried to the next frame. Its share of a step is the
+ * interpolation alpha given to the game before rendering.
+ */
+class FixedTimestep {
+    public:
+        explicit FixedTimestep(double step = FIXED_STEP_DT,
+            int maxSteps = FIXED_STEP_MAX);
+        ~FixedTimestep() = default;
+
+        int advance(double dt);
+        void reset(void);
+
+        double getStep(void) const;
+        double getAlpha(void) const;
+
+    private:
+        double _step;
+        int _maxSteps;
+        double _accumulator = 0;
+};
+
+#endif /* !FIXEDTIMESTEP_HPP_ */
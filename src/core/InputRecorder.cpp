@@ -0,0 +1,279 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** InputRecorder
+*/
+
+#include "InputRecorder.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+//////////////////////////////// InputRecorder ////////////////////////////////
+
+/**
+ * @brief Destroy the InputRecorder object, flushing the file
+ */
+InputRecorder::~InputRecorder()
+{
+    close();
+}
+
+/**
+ * @brief Create a record file and write its header
+ *
+ * @param path The path of the record file
+ * @param seed The seed given to the games of the session
+ * @return true on success, false otherwise
+ */
+bool InputRecorder::open(const std::string &path, std::uint64_t seed)
+{
+    std::uint16_t version = RECORD_VERSION;
+
+    _file.open(path, std::ios::binary | std::ios::trunc);
+    if (!_file.is_open()) {
+        std::cerr << "Unable to open record file: " << path << std::endl;
+        return false;
+    }
+    _file.write(RECORD_MAGIC, RECORD_MAGIC_SIZE);
+    _file.write(reinterpret_cast<const char *>(&version), sizeof(version));
+    _file.write(reinterpret_cast<const char *>(&seed), sizeof(seed));
+    _lastFrame = 0;
+    _lastTimestamp = 0;
+    return _file.good();
+}
+
+/**
+ * @brief Check if a session is being recorded
+ *
+ * @return true if the record file is open
+ */
+bool InputRecorder::isOpen(void) const
+{
+    return _file.is_open();
+}
+
+/**
+ * @brief Write an unsigned LEB128 integer
+ *
+ * @param value The value to write
+ */
+void InputRecorder::writeVarint(std::uint64_t value)
+{
+    char byte = 0;
+
+    do {
+        byte = value & 0x7F;
+        value >>= 7;
+        if (value)
+            byte |= 0x80;
+        _file.put(byte);
+    } while (value);
+}
+
+/**
+ * @brief Write a zigzag-encoded signed integer
+ *
+ * @param value The value to write
+ */
+void InputRecorder::writeSigned(std::int64_t value)
+{
+    writeVarint((static_cast<std::uint64_t>(value) << 1) ^ (value >> 63));
+}
+
+/**
+ * @brief Record the batch of events of a frame
+ *
+ * @param frame The frame number, increasing
+ * @param timestamp The time since the start of the session, in microseconds
+ * @param events The events returned by the display for this frame, their
+ * timestamps relative to the start of the session
+ */
+void InputRecorder::record(std::uint64_t frame, std::uint64_t timestamp,
+    const std::vector<RawEvent> &events)
+{
+    if (!isOpen())
+        return;
+    writeVarint(frame - _lastFrame);
+    writeVarint(timestamp - _lastTimestamp);
+    writeVarint(events.size());
+    for (const RawEvent &event : events) {
+        _file.put(static_cast<char>(event.type));
+        _file.put(static_cast<char>(event.key));
+        writeSigned(event.x);
+        writeSigned(event.y);
+        writeVarint(timestamp - std::min(event.timestamp, timestamp));
+    }
+    _lastFrame = frame;
+    _lastTimestamp = timestamp;
+}
+
+/**
+ * @brief Flush and close the record file
+ */
+void InputRecorder::close(void)
+{
+    if (_file.is_open())
+        _file.close();
+}
+
+//////////////////////////////// InputReplayer ////////////////////////////////
+
+/**
+ * @brief Open a record file and read its header
+ *
+ * @param path The path of the record file
+ * @return true on success, false if the file is missing or invalid
+ */
+bool InputReplayer::open(const std::string &path)
+{
+    char magic[RECORD_MAGIC_SIZE] = {0};
+    std::uint16_t version = 0;
+
+    _file.open(path, std::ios::binary);
+    if (!_file.is_open()) {
+        std::cerr << "Unable to open record file: " << path << std::endl;
+        return false;
+    }
+    _file.read(magic, RECORD_MAGIC_SIZE);
+    _file.read(reinterpret_cast<char *>(&version), sizeof(version));
+    _file.read(reinterpret_cast<char *>(&_seed), sizeof(_seed));
+    if (!_file.good() ||
+        std::memcmp(magic, RECORD_MAGIC, RECORD_MAGIC_SIZE) != 0 ||
+        version != RECORD_VERSION) {
+        std::cerr << "Invalid record file: " << path << std::endl;
+        _file.close();
+        return false;
+    }
+    _frame = 0;
+    _timestamp = 0;
+    _fedTimestamp = 0;
+    _pending = readRecord();
+    return true;
+}
+
+/**
+ * @brief Check if a session is being replayed
+ *
+ * @return true if the record file is open
+ */
+bool InputReplayer::isOpen(void) const
+{
+    return _file.is_open();
+}
+
+/**
+ * @brief Get the seed the recorded session was started with
+ *
+ * @return std::uint64_t The seed
+ */
+std::uint64_t InputReplayer::getSeed(void) const
+{
+    return _seed;
+}
+
+/**
+ * @brief Read an unsigned LEB128 integer
+ *
+ * @param value The value read
+ * @return true on success, false at the end of the file
+ */
+bool InputReplayer::readVarint(std::uint64_t &value)
+{
+    int byte = 0;
+    int shift = 0;
+
+    value = 0;
+    do {
+        byte = _file.get();
+        if (byte == EOF || shift > 63)
+            return false;
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return true;
+}
+
+/**
+ * @brief Read a zigzag-encoded signed integer
+ *
+ * @param value The value read
+ * @return true on success, false at the end of the file
+ */
+bool InputReplayer::readSigned(std::int64_t &value)
+{
+    std::uint64_t raw = 0;
+
+    if (!readVarint(raw))
+        return false;
+    value = static_cast<std::int64_t>(raw >> 1) ^ -static_cast<std::int64_t>(raw & 1);
+    return true;
+}
+
+/**
+ * @brief Read the next record into the pending batch
+ *
+ * @return true if a complete record was read
+ */
+bool InputReplayer::readRecord(void)
+{
+    std::uint64_t frameDelta = 0;
+    std::uint64_t timestampDelta = 0;
+    std::uint64_t count = 0;
+    std::int64_t x = 0;
+    std::int64_t y = 0;
+    std::uint64_t age = 0;
+
+    if (!readVarint(frameDelta) || !readVarint(timestampDelta) ||
+        !readVarint(count))
+        return false;
+    _frame += frameDelta;
+    _timestamp += timestampDelta;
+    _events.clear();
+    for (std::uint64_t i = 0; i < count; i++) {
+        int type = _file.get();
+        int key = _file.get();
+        if (key == EOF || !readSigned(x) || !readSigned(y) ||
+            !readVarint(age))
+            return false;
+        _events.push_back({static_cast<EventType>(type),
+            static_cast<EventKey>(key), static_cast<int>(x),
+            static_cast<int>(y), _timestamp - std::min(age, _timestamp)});
+    }
+    return true;
+}
+
+/**
+ * @brief Get the recorded events of a frame
+ *
+ * @param frame The frame number, increasing between calls
+ * @param events Filled with the recorded events of the frame
+ * @return true while the replay goes on, false once every record was fed
+ */
+bool InputReplayer::next(std::uint64_t frame, std::vector<RawEvent> &events)
+{
+    events.clear();
+    while (_pending && _frame < frame)
+        _pending = readRecord();
+    if (!_pending)
+        return false;
+    if (_frame == frame) {
+        events = _events;
+        _fedTimestamp = _timestamp;
+        _pending = readRecord();
+    }
+    return true;
+}
+
+/**
+ * @brief Get the recorded timestamp of the last frame fed by next
+ *
+ * @return std::uint64_t The time since the start of the session, in
+ * microseconds
+ */
+std::uint64_t InputReplayer::getTimestamp(void) const
+{
+    return _fedTimestamp;
+}
@@ -0,0 +1,78 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** InputRecorder
+*/
+
+#ifndef INPUTRECORDER_HPP_
+    #define INPUTRECORDER_HPP_
+
+    #include <cstdint>
+    #include <fstream>
+    #include <string>
+    #include <vector>
+
+    #include "../interfaces/IType.hpp"
+
+    #define RECORD_MAGIC "ARCREC"
+    #define RECORD_MAGIC_SIZE 6
+    #define RECORD_VERSION 2
+
+/**
+ * Layout of a record file:
+ *  - header: "ARCREC", u16 version, u64 seed
+ *  - one record per frame: varint frame delta, varint timestamp delta
+ *    (microseconds), varint event count, then for each event u8 type,
+ *    u8 key, zigzag varint x and y, varint age (microseconds between the
+ *    event and the frame timestamp)
+ * Every batch returned by pollEvent is recorded, empty ones included, so
+ * that the replay keeps the timeline of the session.
+ */
+
+class InputRecorder {
+    public:
+        InputRecorder() = default;
+        ~InputRecorder();
+
+        bool open(const std::string &path, std::uint64_t seed);
+        bool isOpen(void) const;
+        void record(std::uint64_t frame, std::uint64_t timestamp,
+            const std::vector<RawEvent> &events);
+        void close(void);
+
+    private:
+        void writeVarint(std::uint64_t value);
+        void writeSigned(std::int64_t value);
+
+        std::ofstream _file;
+        std::uint64_t _lastFrame = 0;
+        std::uint64_t _lastTimestamp = 0;
+};
+
+class InputReplayer {
+    public:
+        InputReplayer() = default;
+        ~InputReplayer() = default;
+
+        bool open(const std::string &path);
+        bool isOpen(void) const;
+        std::uint64_t getSeed(void) const;
+        bool next(std::uint64_t frame, std::vector<RawEvent> &events);
+        std::uint64_t getTimestamp(void) const;
+
+    private:
+        bool readVarint(std::uint64_t &value);
+        bool readSigned(std::int64_t &value);
+        bool readRecord(void);
+
+        std::ifstream _file;
+        std::uint64_t _seed = 0;
+        bool _pending = false;
+        std::uint64_t _frame = 0;
+        std::uint64_t _timestamp = 0;
+        std::uint64_t _fedTimestamp = 0;
+        std::vector<RawEvent> _events;
+};
+
+#endif /* !INPUTRECORDER_HPP_ */
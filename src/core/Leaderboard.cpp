@@ -0,0 +1,148 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Leaderboard
+*/
+
+#include "Leaderboard.hpp"
+
+#include <algorithm>
+
+#include "ScoreManager.hpp"
+
+/**
+ * @brief Get the process-wide leaderboard
+ *
+ * @return Leaderboard& The shared leaderboard instance
+ */
+Leaderboard &Leaderboard::getInstance(void)
+{
+    static Leaderboard instance;
+
+    return instance;
+}
+
+/**
+ * @brief Get the board of a game, loading its score file on first use
+ *
+ * Must be called with _mutex held.
+ *
+ * @param gameName The name of the game
+ * @return Board& The board of the game
+ */
+Leaderboard::Board &Leaderboard::getBoard(const std::string &gameName)
+{
+    auto it = _boards.find(gameName);
+    ScoreManager scoreManager;
+
+    if (it != _boards.end())
+        return it->second;
+    Board &board = _boards[gameName];
+    board.scores = scoreManager.loadScoresFromFile(
+        ScoreManager::getScoreFileName(gameName));
+    std::stable_sort(board.scores.begin(), board.scores.end(),
+        [](const auto &a, const auto &b) { return a.first > b.first; });
+    formatRows(board);
+    board.version = 1;
+    return board;
+}
+
+/**
+ * @brief Build the preformatted "name: score" rows of a board
+ *
+ * Must be called with _mutex held.
+ *
+ * @param board The board to format
+ */
+void Leaderboard::formatRows(Board &board)
+{
+    std::size_t count = std::min<std::size_t>(
+        board.scores.size(), LEADERBOARD_ROWS);
+
+    board.rows.clear();
+    board.rows.reserve(count ? count : 1);
+    for (std::size_t i = 0; i < count; i++) {
+        board.rows.push_back(board.scores[i].second + ": " +
+            std::to_string(static_cast<int>(board.scores[i].first)));
+    }
+    if (board.rows.empty())
+        board.rows.push_back(LEADERBOARD_EMPTY_ROW);
+}
+
+/**
+ * @brief Merge a score into a game's board
+ *
+ * Only the best score of each player is kept. The entry is moved to
+ * its sorted position instead of re-sorting the whole board, and the
+ * version is bumped only if the board actually changed.
+ *
+ * @param gameName The name of the game
+ * @param score The score and the player name
+ * @return true if the board changed
+ */
+bool Leaderboard::submit(const std::string &gameName,
+    const std::pair<float, std::string> &score)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    Board &board = getBoard(gameName);
+    auto byScore = [](const auto &a, const auto &b) {
+        return a.first > b.first;
+    };
+    auto it = std::find_if(board.scores.begin(), board.scores.end(),
+        [&score](const auto &entry) { return entry.second == score.second; });
+
+    if (it != board.scores.end()) {
+        if (score.first <= it->first)
+            return false;
+        board.scores.erase(it);
+    }
+    board.scores.insert(std::upper_bound(board.scores.begin(),
+        board.scores.end(), score, byScore), score);
+    formatRows(board);
+    board.version++;
+    return true;
+}
+
+/**
+ * @brief Get every score of a game, best first
+ *
+ * @param gameName The name of the game
+ * @return std::vector<std::pair<float, std::string>> The sorted scores
+ */
+std::vector<std::pair<float, std::string>> Leaderboard::getScores(
+    const std::string &gameName)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return getBoard(gameName).scores;
+}
+
+/**
+ * @brief Get the preformatted top rows of a game
+ *
+ * @param gameName The name of the game
+ * @return std::vector<std::string> At most LEADERBOARD_ROWS rows, or a
+ * single placeholder row if the game has no score yet
+ */
+std::vector<std::string> Leaderboard::getRows(const std::string &gameName)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return getBoard(gameName).rows;
+}
+
+/**
+ * @brief Get the version of a game's board
+ *
+ * The version changes every time the rows of the board change.
+ *
+ * @param gameName The name of the game
+ * @return std::size_t The current version
+ */
+std::size_t Leaderboard::getVersion(const std::string &gameName)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+
+    return getBoard(gameName).version;
+}
@@ -0,0 +1,61 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Leaderboard
+*/
+
+#ifndef LEADERBOARD_HPP_
+    #define LEADERBOARD_HPP_
+
+    #include <cstddef>
+    #include <mutex>
+    #include <string>
+    #include <unordered_map>
+    #include <vector>
+
+    #define LEADERBOARD_ROWS 20
+    #define LEADERBOARD_EMPTY_ROW "No scores available"
+
+/**
+ * @brief In-memory leaderboard shared by the core and the menu
+ *
+ * Each game's score file is parsed once, the first time the game is
+ * queried. Saved scores are merged in place and bump the board version,
+ * so readers only have to rebuild their view when the version changes.
+ *
+ * The core executable is linked with -rdynamic: when the menu library
+ * is loaded by the core, its calls to getInstance() resolve to the
+ * core's instance, so both sides share the same boards.
+ */
+class Leaderboard {
+    public:
+        static Leaderboard &getInstance(void);
+
+        bool submit(const std::string &gameName,
+            const std::pair<float, std::string> &score);
+        std::vector<std::pair<float, std::string>> getScores(
+            const std::string &gameName);
+        std::vector<std::string> getRows(const std::string &gameName);
+        std::size_t getVersion(const std::string &gameName);
+
+    private:
+        struct Board {
+            std::vector<std::pair<float, std::string>> scores;
+            std::vector<std::string> rows;
+            std::size_t version = 0;
+        };
+
+        Leaderboard() = default;
+        ~Leaderboard() = default;
+        Leaderboard(const Leaderboard &) = delete;
+        Leaderboard &operator=(const Leaderboard &) = delete;
+
+        Board &getBoard(const std::string &gameName);
+        void formatRows(Board &board);
+
+        std::mutex _mutex;
+        std::unordered_map<std::string, Board> _boards;
+};
+
+#endif /* !LEADERBOARD_HPP_ */
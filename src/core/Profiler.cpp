@@ -0,0 +1,519 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Profiler
+*/
+
+#include "Profiler.hpp"
+
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+
+#include "AllocCounter.hpp"
+#include "Tracer.hpp"
+
+////////////////////////////////// Histogram //////////////////////////////////
+
+/**
+ * @brief Construct an empty histogram
+ */
+Histogram::Histogram()
+{
+    for (auto &bucket : _buckets)
+        bucket.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the bucket holding a value
+ *
+ * @param value The value to store
+ * @return std::size_t The index of its bucket
+ */
+std::size_t Histogram::getBucketIndex(std::uint64_t value)
+{
+    int msb = 0;
+
+    if (value < HISTOGRAM_SUB_BUCKETS)
+        return value;
+    msb = 63 - __builtin_clzll(value);
+    return (msb - 2) * HISTOGRAM_SUB_BUCKETS +
+        ((value >> (msb - 3)) & (HISTOGRAM_SUB_BUCKETS - 1));
+}
+
+/**
+ * @brief Get the greatest value stored in a bucket
+ *
+ * @param index The index of the bucket
+ * @return std::uint64_t The upper bound of the bucket
+ */
+std::uint64_t Histogram::getBucketUpperBound(std::size_t index)
+{
+    int shift = 0;
+    std::uint64_t sub = index % HISTOGRAM_SUB_BUCKETS;
+
+    if (index < HISTOGRAM_SUB_BUCKETS)
+        return index;
+    shift = index / HISTOGRAM_SUB_BUCKETS - 1;
+    return ((HISTOGRAM_SUB_BUCKETS + sub) << shift) +
+        ((std::uint64_t(1) << shift) - 1);
+}
+
+/**
+ * @brief Record a value
+ *
+ * @param value The value to record
+ */
+void Histogram::record(std::uint64_t value)
+{
+    std::uint64_t max = _max.load(std::memory_order_relaxed);
+
+    _buckets[getBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    _count.fetch_add(1, std::memory_order_relaxed);
+    _sum.fetch_add(value, std::memory_order_relaxed);
+    while (value > max &&
+        !_max.compare_exchange_weak(max, value, std::memory_order_relaxed));
+}
+
+/**
+ * @brief Get a percentile of the recorded values
+ *
+ * @param percentile The percentile to get, between 0 and 100
+ * @return std::uint64_t The upper bound of the bucket of the percentile
+ */
+std::uint64_t Histogram::getPercentile(double percentile) const
+{
+    std::uint64_t count = getCount();
+    std::uint64_t target = std::ceil(percentile / 100.0 * count);
+    std::uint64_t seen = 0;
+
+    if (count == 0)
+        return 0;
+    if (target == 0)
+        target = 1;
+    for (std::size_t i = 0; i < HISTOGRAM_BUCKETS; i++) {
+        seen += _buckets[i].load(std::memory_order_relaxed);
+        if (seen >= target)
+            return std::min(getBucketUpperBound(i), getMax());
+    }
+    return getMax();
+}
+
+/**
+ * @brief Get the greatest recorded value
+ *
+ * @return std::uint64_t The maximum
+ */
+std::uint64_t Histogram::getMax(void) const
+{
+    return _max.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the number of recorded values
+ *
+ * @return std::uint64_t The count
+ */
+std::uint64_t Histogram::getCount(void) const
+{
+    return _count.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the mean of the recorded values
+ *
+ * @return double The mean, 0 if nothing was recorded
+ */
+double Histogram::getMean(void) const
+{
+    std::uint64_t count = getCount();
+
+    if (count == 0)
+        return 0;
+    return static_cast<double>(_sum.load(std::memory_order_relaxed)) / count;
+}
+
+//////////////////////////////////// Scope ////////////////////////////////////
+
+/**
+ * @brief Start timing a stage
+ *
+ * The stage is also emitted as a trace slice when tracing is enabled.
+ *
+ * @param profiler The profiler to record into
+ * @param stage The timed stage
+ */
+Profiler::Scope::Scope(Profiler &profiler, ProfileStage stage)
+    : _profiler(profiler), _stage(stage),
+      _start(std::chrono::steady_clock::now())
+{
+    Tracer::getInstance().begin(getStageName(_stage));
+}
+
+/**
+ * @brief Stop timing the stage and record its duration
+ */
+Profiler::Scope::~Scope()
+{
+    auto elapsed = std::chrono::steady_clock::now() - _start;
+
+    Tracer::getInstance().end(getStageName(_stage));
+    _profiler.record(_stage,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+}
+
+/**
+ * @brief Begin a frame
+ *
+ * @param profiler The profiler to record the frame in
+ */
+Profiler::Frame::Frame(Profiler &profiler)
+    : _profiler(profiler)
+{
+    _profiler.beginFrame();
+}
+
+/**
+ * @brief Discard the frame if it was left without being ended
+ */
+Profiler::Frame::~Frame()
+{
+    discard();
+}
+
+/**
+ * @brief End the frame and record it
+ *
+ * @param entityCount The number of entities rendered by the game
+ */
+void Profiler::Frame::end(std::size_t entityCount)
+{
+    if (!_isOpen)
+        return;
+    _isOpen = false;
+    _profiler.endFrame(entityCount);
+}
+
+/**
+ * @brief Close the frame without recording it
+ */
+void Profiler::Frame::discard(void)
+{
+    if (!_isOpen)
+        return;
+    _isOpen = false;
+    _profiler.discardFrame();
+}
+
+/////////////////////////////////// Profiler ///////////////////////////////////
+
+/**
+ * @brief Construct a new Profiler object
+ */
+Profiler::Profiler()
+{
+}
+
+/**
+ * @brief Get the name of a stage, as written in the overlay and the dumps
+ *
+ * @param stage The stage
+ * @return const char* The name of the stage
+ */
+const char *Profiler::getStageName(ProfileStage stage)
+{
+    static const char *names[STAGE_COUNT] = {"poll_event", "hot_keys",
+        "update", "handle_event", "fixed_update", "render_game",
+        "render_entities", "display", "frame", "input_latency"};
+
+    return names[stage];
+}
+
+/**
+ * @brief Record the duration of a stage
+ *
+ * @param stage The stage
+ * @param nanoseconds The duration of the stage
+ */
+void Profiler::record(ProfileStage stage, std::uint64_t nanoseconds)
+{
+    _stages[stage].record(nanoseconds);
+}
+
+/**
+ * @brief Mark the start of a frame
+ */
+void Profiler::beginFrame(void)
+{
+    Tracer::getInstance().begin(getStageName(STAGE_FRAME));
+    _frameStart = std::chrono::steady_clock::now();
+    _frameAllocStart = AllocCounter::getCount();
+    if (!AllocCounter::isTracking())
+        return;
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        _phaseAllocStart[i] =
+            AllocCounter::getPhaseCount(static_cast<AllocPhase>(i));
+        _phaseBytesStart[i] =
+            AllocCounter::getPhaseBytes(static_cast<AllocPhase>(i));
+    }
+}
+
+/**
+ * @brief Mark the end of a frame and record its totals
+ *
+ * When the allocations are tracked, the allocations of the frame are also
+ * recorded for each phase.
+ *
+ * @param entityCount The number of entities rendered by the game
+ */
+void Profiler::endFrame(std::size_t entityCount)
+{
+    auto elapsed = std::chrono::steady_clock::now() - _frameStart;
+
+    record(STAGE_FRAME,
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+    _entities.record(entityCount);
+    _allocations.record(AllocCounter::getCount() - _frameAllocStart);
+    if (AllocCounter::isTracking()) {
+        for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+            AllocPhase phase = static_cast<AllocPhase>(i);
+            _phaseAllocations[i].record(
+                AllocCounter::getPhaseCount(phase) - _phaseAllocStart[i]);
+            _phaseBytes[i].record(
+                AllocCounter::getPhaseBytes(phase) - _phaseBytesStart[i]);
+        }
+    }
+    _frames++;
+    Tracer::getInstance().end(getStageName(STAGE_FRAME));
+}
+
+/**
+ * @brief Close a frame that was cut short, without recording it
+ *
+ * Only the frame slice of the trace is ended, so that it stays balanced;
+ * the histograms are left untouched.
+ */
+void Profiler::discardFrame(void)
+{
+    Tracer::getInstance().end(getStageName(STAGE_FRAME));
+}
+
+//------------------------------- Overlay -------------------------------//
+
+/**
+ * @brief Show or hide the overlay
+ */
+void Profiler::toggleOverlay(void)
+{
+    _overlayVisible = !_overlayVisible;
+    _overlay.clear();
+}
+
+/**
+ * @brief Check if the overlay is visible
+ *
+ * @return true if the overlay is drawn on top of the game
+ */
+bool Profiler::isOverlayVisible(void) const
+{
+    return _overlayVisible;
+}
+
+/**
+ * @brief Append a text line to the overlay
+ *
+ * The entity names start with "zz" so that they are drawn after the
+ * entities of the game.
+ *
+ * @param text The content of the line
+ */
+void Profiler::addOverlayLine(const std::string &text)
+{
+    Entity line;
+    char name[32];
+
+    std::snprintf(name, sizeof(name), "zz-profiler-%02zu", _overlay.size());
+    line.type = TEXT;
+    line.x = PROFILER_OVERLAY_X;
+    line.y = PROFILER_OVERLAY_Y + _overlay.size() * PROFILER_OVERLAY_LINE;
+    line.width = PROFILER_OVERLAY_SIZE;
+    line.height = 0;
+    line.rotate = 0;
+    line.RGB[0] = 255;
+    line.RGB[1] = 255;
+    line.RGB[2] = 0;
+    line.sprites[GRAPHICAL] = text;
+    line.sprites[TERMINAL] = text;
+    _overlay[name] = line;
+}
+
+/**
+ * @brief Append the allocations of each phase to the overlay
+ */
+void Profiler::addOverlayPhases(void)
+{
+    char text[128];
+    char name[32];
+
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        const Histogram &count = _phaseAllocations[i];
+        std::snprintf(name, sizeof(name), "alloc_%s",
+            AllocCounter::getPhaseName(static_cast<AllocPhase>(i)));
+        std::snprintf(text, sizeof(text),
+            "%-18s p50 %7llu p99 %7llu max %7llu %9.0f B",
+            name, (unsigned long long)count.getPercentile(50),
+            (unsigned long long)count.getPercentile(99),
+            (unsigned long long)count.getMax(), _phaseBytes[i].getMean());
+        addOverlayLine(text);
+    }
+}
+
+/**
+ * @brief Rebuild the overlay lines from the histograms
+ */
+void Profiler::updateOverlay(void)
+{
+    char text[128];
+
+    _overlay.clear();
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        const Histogram &stage = _stages[i];
+        std::snprintf(text, sizeof(text),
+            "%-15s p50 %7.3f p95 %7.3f p99 %7.3f max %7.3f ms",
+            getStageName(static_cast<ProfileStage>(i)),
+            stage.getPercentile(50) / 1e6, stage.getPercentile(95) / 1e6,
+            stage.getPercentile(99) / 1e6, stage.getMax() / 1e6);
+        addOverlayLine(text);
+    }
+    std::snprintf(text, sizeof(text),
+        "%-15s p50 %7llu p95 %7llu p99 %7llu max %7llu", "entities",
+        (unsigned long long)_entities.getPercentile(50),
+        (unsigned long long)_entities.getPercentile(95),
+        (unsigned long long)_entities.getPercentile(99),
+        (unsigned long long)_entities.getMax());
+    addOverlayLine(text);
+    std::snprintf(text, sizeof(text),
+        "%-15s p50 %7llu p95 %7llu p99 %7llu max %7llu", "allocations",
+        (unsigned long long)_allocations.getPercentile(50),
+        (unsigned long long)_allocations.getPercentile(95),
+        (unsigned long long)_allocations.getPercentile(99),
+        (unsigned long long)_allocations.getMax());
+    addOverlayLine(text);
+    if (AllocCounter::isTracking())
+        addOverlayPhases();
+}
+
+/**
+ * @brief Add the overlay entities to the entities of a frame
+ *
+ * The lines are only recomputed every PROFILER_OVERLAY_REFRESH frames so
+ * that the overlay stays readable and cheap.
+ *
+ * @param entities The entities of the frame
+ */
+void Profiler::addOverlay(std::map<std::string, Entity> &entities)
+{
+    if (!_overlayVisible)
+        return;
+    if (_overlay.empty() || _frames % PROFILER_OVERLAY_REFRESH == 0)
+        updateOverlay();
+    entities.insert(_overlay.begin(), _overlay.end());
+}
+
+//-------------------------------- Dump --------------------------------//
+
+/**
+ * @brief Write the statistics as CSV
+ *
+ * @param out The output stream
+ * @return true if the stream is still good
+ */
+bool Profiler::dumpCsv(std::ostream &out) const
+{
+    auto writeRow = [&out](const char *name, const char *unit,
+        const Histogram &histogram) {
+        out << name << "," << unit << "," << histogram.getCount() << ","
+            << histogram.getMean() << "," << histogram.getPercentile(50)
+            << "," << histogram.getPercentile(95) << ","
+            << histogram.getPercentile(99) << "," << histogram.getMax()
+            << "\n";
+    };
+
+    out << "metric,unit,count,mean,p50,p95,p99,max\n";
+    for (int i = 0; i < STAGE_COUNT; i++)
+        writeRow(getStageName(static_cast<ProfileStage>(i)), "ns", _stages[i]);
+    writeRow("entities", "count", _entities);
+    writeRow("allocations", "count", _allocations);
+    if (!AllocCounter::isTracking())
+        return out.good();
+    for (int i = 0; i < ALLOC_PHASE_COUNT; i++) {
+        std::string name = std::string("alloc_") +
+            AllocCounter::getPhaseName(static_cast<AllocPhase>(i));
+        writeRow(name.c_str(), "count", _phaseAllocations[i]);
+        writeRow(name.c_str(), "bytes", _phaseBytes[i]);
+    }
+    return out.good();
+}
+
+/**
+ * @brief Write the statistics as JSON
+ *
+ * @param out The output stream
+ * @return true if the stream is still good
+ */
+bool Profiler::dumpJson(std::ostream &out) const
+{
+    auto writeObject = [&out](const char *name, const char *unit,
+        const Histogram &histogram) {
+        out << "    {\"name\": \"" << name << "\", \"unit\": \"" << unit
+            << "\", \"count\": " << histogram.getCount()
+            << ", \"mean\": " << histogram.getMean()
+            << ", \"p50\": " << histogram.getPercentile(50)
+            << ", \"p95\": " << histogram.getPercentile(95)
+            << ", \"p99\": " << histogram.getPercentile(99)
+            << ", \"max\": " << histogram.getMax() << "}";
+    };
+
+    out << "{\n  \"frames\": " << _frames << ",\n  \"metrics\": [\n";
+    for (int i = 0; i < STAGE_COUNT; i++) {
+        writeObject(
+            getStageName(static_cast<ProfileStage>(i)), "ns", _stages[i]);
+        out << ",\n";
+    }
+    writeObject("entities", "count", _entities);
+    out << ",\n";
+    writeObject("allocations", "count", _allocations);
+    for (int i = 0; AllocCounter::isTracking() && i < ALLOC_PHASE_COUNT; i++) {
+        std::string name = std::string("alloc_") +
+            AllocCounter::getPhaseName(static_cast<AllocPhase>(i));
+        out << ",\n";
+        writeObject(name.c_str(), "count", _phaseAllocations[i]);
+        out << ",\n";
+        writeObject(name.c_str(), "bytes", _phaseBytes[i]);
+    }
+    out << "\n  ]\n}\n";
+    return out.good();
+}
+
+/**
+ * @brief Write the statistics to a file
+ *
+ * The file is written as CSV if its name ends with ".csv", and as JSON
+ * otherwise.
+ *
+ * @param path The path of the output file
+ * @return true on success, false otherwise
+ */
+bool Profiler::dump(const std::string &path) const
+{
+    std::ofstream out(path, std::ios::trunc);
+    bool csv = path.size() >= 4 && path.compare(path.size() - 4, 4, ".csv") == 0;
+
+    if (!out.is_open()) {
+        std::cerr << "Unable to open profile output: " << path << std::endl;
+        return false;
+    }
+    return csv ? dumpCsv(out) : dumpJson(out);
+}
@@ -0,0 +1,144 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Profiler
+*/
+
+#ifndef PROFILER_HPP_
+    #define PROFILER_HPP_
+
+    #include <array>
+    #include <atomic>
+    #include <chrono>
+    #include <cstdint>
+    #include <map>
+    #include <string>
+
+    #include "../libs/game/interfaces/IGame.hpp"
+    #include "AllocCounter.hpp"
+
+    #define HISTOGRAM_SUB_BUCKETS 8
+    #define HISTOGRAM_BUCKETS (62 * HISTOGRAM_SUB_BUCKETS)
+
+    #define PROFILER_OVERLAY_X 10
+    #define PROFILER_OVERLAY_Y 10
+    #define PROFILER_OVERLAY_LINE 18
+    #define PROFILER_OVERLAY_SIZE 14
+    #define PROFILER_OVERLAY_REFRESH 30
+
+enum ProfileStage {
+    STAGE_POLL_EVENT,
+    STAGE_HOT_KEYS,
+    STAGE_UPDATE,
+    STAGE_HANDLE_EVENT,
+    STAGE_FIXED_UPDATE,
+    STAGE_RENDER_GAME,
+    STAGE_RENDER_ENTITIES,
+    STAGE_DISPLAY,
+    STAGE_FRAME,
+    // Time from a press to the end of the frame it was handled in
+    STAGE_INPUT_LATENCY,
+    STAGE_COUNT
+};
+
+/**
+ * @brief Lock-free log-linear histogram
+ *
+ * Values are stored in buckets of 8 sub-buckets per power of two, so a
+ * percentile is reported with at most 12.5% of error. Recording is a few
+ * relaxed atomic operations and never allocates.
+ */
+class Histogram {
+    public:
+        Histogram();
+        ~Histogram() = default;
+
+        void record(std::uint64_t value);
+        std::uint64_t getPercentile(double percentile) const;
+        std::uint64_t getMax(void) const;
+        std::uint64_t getCount(void) const;
+        double getMean(void) const;
+
+    private:
+        static std::size_t getBucketIndex(std::uint64_t value);
+        static std::uint64_t getBucketUpperBound(std::size_t index);
+
+        std::array<std::atomic<std::uint64_t>, HISTOGRAM_BUCKETS> _buckets;
+        std::atomic<std::uint64_t> _count{0};
+        std::atomic<std::uint64_t> _sum{0};
+        std::atomic<std::uint64_t> _max{0};
+};
+
+class Profiler {
+    public:
+        /**
+         * @brief Times a stage from its construction to its destruction
+         */
+        class Scope {
+            public:
+                Scope(Profiler &profiler, ProfileStage stage);
+                ~Scope();
+
+            private:
+                Profiler &_profiler;
+                ProfileStage _stage;
+                std::chrono::steady_clock::time_point _start;
+        };
+
+        /**
+         * @brief Opens a frame on construction, and discards it on
+         * destruction unless it was ended, so that every early exit of the
+         * main loop closes the frame slice of the trace
+         */
+        class Frame {
+            public:
+                explicit Frame(Profiler &profiler);
+                ~Frame();
+
+                void end(std::size_t entityCount);
+                void discard(void);
+
+            private:
+                Profiler &_profiler;
+                bool _isOpen = true;
+        };
+
+        Profiler();
+        ~Profiler() = default;
+
+        void beginFrame(void);
+        void endFrame(std::size_t entityCount);
+        void discardFrame(void);
+        void record(ProfileStage stage, std::uint64_t nanoseconds);
+
+        void toggleOverlay(void);
+        bool isOverlayVisible(void) const;
+        void addOverlay(std::map<std::string, Entity> &entities);
+
+        bool dump(const std::string &path) const;
+
+        static const char *getStageName(ProfileStage stage);
+
+    private:
+        void updateOverlay(void);
+        void addOverlayPhases(void);
+        void addOverlayLine(const std::string &text);
+        bool dumpCsv(std::ostream &out) const;
+        bool dumpJson(std::ostream &out) const;
+
+        std::array<Histogram, STAGE_COUNT> _stages;
+        Histogram _entities;
+        Histogram _allocations;
+        std::chrono::steady_clock::time_point _frameStart;
+        std::uint64_t _frameAllocStart = 0;
+        std::array<Histogram, ALLOC_PHASE_COUNT> _phaseAllocations;
+        std::array<Histogram, ALLOC_PHASE_COUNT> _phaseBytes;
+        std::array<std::uint64_t, ALLOC_PHASE_COUNT> _phaseAllocStart{};
+        std::array<std::uint64_t, ALLOC_PHASE_COUNT> _phaseBytesStart{};
+        std::uint64_t _frames = 0;
+        bool _overlayVisible = false;
+        std::map<std::string, Entity> _overlay;
+};
+
+#endif /* !PROFILER_HPP_ */
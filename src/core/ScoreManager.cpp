@@ -6,6 +6,8 @@
 */
 
 #include "ScoreManager.hpp"
+#include "Leaderboard.hpp"
+#include "../interfaces/Trace.hpp"
 
 /**
  * @brief Construct a new Score Manager:: Score Manager object
@@ -26,11 +28,21 @@ ScoreManager::~ScoreManager()
  */
 void ScoreManager::createScoreDirectory()
 {
-    if (!std::filesystem::exists("score")) {
-        std::filesystem::create_directory("score");
+    if (!std::filesystem::exists(SCORE_DIRECTORY)) {
+        std::filesystem::create_directory(SCORE_DIRECTORY);
     }
 }
 
+/**
+ * @brief Get the path of the score file of a game
+ * @param gameName The name of the game.
+ * @return The path of the score file.
+ */
+std::string ScoreManager::getScoreFileName(const std::string &gameName)
+{
+    return std::string(SCORE_DIRECTORY) + "/score_" + gameName + ".txt";
+}
+
 /**
  * @brief Loads existing scores from a file.
  * @param fileName The name of the file to load scores from.
@@ -39,6 +51,7 @@ void ScoreManager::createScoreDirectory()
 std::vector<std::pair<float, std::string>> ScoreManager::loadScoresFromFile(
     const std::string &fileName)
 {
+    TraceScope trace("ScoreManager::loadScoresFromFile");
     std::vector<std::pair<float, std::string>> scores;
 
     if (!std::filesystem::exists(fileName)) {
@@ -69,35 +82,6 @@ std::vector<std::pair<float, std::string>> ScoreManager::loadScoresFromFile(
     return scores;
 }
 
-/**
- * @brief Updates a player's score or adds a new score.
- * @param scores The vector of current scores.
- * @param newScore The new score to add or update.
- */
-void ScoreManager::updatePlayerScore(
-    std::vector<std::pair<float, std::string>> &scores,
-    const std::pair<float, std::string> &newScore)
-{
-    bool playerExists = false;
-
-    for (auto &entry : scores) {
-        if (entry.second == newScore.second) {
-            playerExists = true;
-            if (newScore.first > entry.first) {
-                entry.first = newScore.first;
-            }
-            break;
-        }
-    }
-
-    if (!playerExists) {
-        scores.push_back(newScore);
-    }
-
-    std::sort(scores.begin(), scores.end(),
-        [](const auto &a, const auto &b) { return a.first > b.first; });
-}
-
 /**
  * @brief Writes scores to a file.
  * @param fileName The name of the file to write scores to.
@@ -107,6 +91,7 @@ void ScoreManager::updatePlayerScore(
 bool ScoreManager::writeScoresToFile(const std::string &fileName,
     const std::vector<std::pair<float, std::string>> &scores)
 {
+    TraceScope trace("ScoreManager::writeScoresToFile");
     std::ofstream outfile(fileName, std::ios::trunc);
     if (!outfile.is_open()) {
         std::cerr << "Unable to open score file for writing: " << fileName
@@ -124,18 +109,25 @@ bool ScoreManager::writeScoresToFile(const std::string &fileName,
 
 /**
  * @brief Saves the score to a file.
+ *
+ * The score is merged into the shared leaderboard, which keeps the
+ * scores of the game in memory, then the whole board is written back.
+ * Nothing is written when the score does not beat the player's best.
+ *
+ * @param gameName The name of the game.
  * @param score The score to save, as a pair of float and string.
  */
 void ScoreManager::saveScore(std::string gameName, std::pair<float, std::string> score)
 {
-    std::string fileName = "score/score_" + gameName + ".txt";
-    auto scores = loadScoresFromFile(fileName);
+    Leaderboard &leaderboard = Leaderboard::getInstance();
 
     if (score.second.empty()) {
         return;
     }
+    if (!leaderboard.submit(gameName, score)) {
+        return;
+    }
     createScoreDirectory();
-    updatePlayerScore(scores, score);
-    writeScoresToFile(fileName, scores);
+    writeScoresToFile(
+        getScoreFileName(gameName), leaderboard.getScores(gameName));
 }
-
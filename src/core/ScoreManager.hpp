@@ -17,6 +17,8 @@
     #include <memory>
     #include <vector>
 
+    #define SCORE_DIRECTORY "score"
+
 class ScoreManager {
     public:
         ScoreManager();
@@ -26,12 +28,10 @@ class ScoreManager {
             std::string gameName, std::pair<float, std::string> score);
         std::vector<std::pair<float, std::string>> loadScoresFromFile(
             const std::string &fileName);
+        static std::string getScoreFileName(const std::string &gameName);
 
     private:
         void createScoreDirectory(void);
-        void updatePlayerScore(
-            std::vector<std::pair<float, std::string>> &scores,
-            const std::pair<float, std::string> &score);
         bool writeScoresToFile(const std::string &fileName,
             const std::vector<std::pair<float, std::string>> &scores);
 };
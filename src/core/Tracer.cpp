@@ -0,0 +1,185 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Tracer
+*/
+
+#include "Tracer.hpp"
+
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+/**
+ * @brief Get the process-wide tracer
+ *
+ * @return Tracer& The shared tracer instance
+ */
+Tracer &Tracer::getInstance(void)
+{
+    static Tracer instance;
+
+    return instance;
+}
+
+/**
+ * @brief Start or stop recording events
+ *
+ * @param enabled true to record events
+ */
+void Tracer::setEnabled(bool enabled)
+{
+    _enabled.store(enabled, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Check if events are recorded
+ *
+ * @return true if tracing is enabled
+ */
+bool Tracer::isEnabled(void) const
+{
+    return _enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Get the ring buffer of the calling thread, creating it if needed
+ *
+ * @return TraceBuffer& The buffer of the calling thread
+ */
+TraceBuffer &Tracer::getThreadBuffer(void)
+{
+    thread_local TraceBuffer *buffer = nullptr;
+
+    if (!buffer) {
+        std::lock_guard<std::mutex> lock(_mutex);
+        auto newBuffer = std::make_unique<TraceBuffer>();
+        newBuffer->events.resize(TRACE_BUFFER_SIZE);
+        newBuffer->threadId = _buffers.size() + 1;
+        buffer = newBuffer.get();
+        _buffers.push_back(std::move(newBuffer));
+    }
+    return *buffer;
+}
+
+/**
+ * @brief Record an event in the buffer of the calling thread
+ *
+ * @param name The name of the event, truncated to TRACE_NAME_SIZE - 1
+ * @param phase 'B' for a begin event, 'E' for an end event
+ */
+void Tracer::push(const char *name, char phase)
+{
+    TraceBuffer &buffer = getThreadBuffer();
+    std::uint64_t timestamp = std::chrono::duration_cast<
+        std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    std::lock_guard<std::mutex> lock(buffer.mutex);
+    TraceEvent &event = buffer.events[buffer.head % TRACE_BUFFER_SIZE];
+
+    event.timestamp = timestamp;
+    event.phase = phase;
+    std::strncpy(event.name, name ? name : "", TRACE_NAME_SIZE - 1);
+    event.name[TRACE_NAME_SIZE - 1] = '\0';
+    buffer.head++;
+}
+
+/**
+ * @brief Record the beginning of a slice
+ *
+ * @param name The name of the slice
+ */
+void Tracer::begin(const char *name)
+{
+    if (isEnabled())
+        push(name, 'B');
+}
+
+/**
+ * @brief Record the end of a slice
+ *
+ * @param name The name of the slice
+ */
+void Tracer::end(const char *name)
+{
+    if (isEnabled())
+        push(name, 'E');
+}
+
+/**
+ * @brief Write the recorded events as Chrome trace-event JSON
+ *
+ * The file can be opened with chrome://tracing or ui.perfetto.dev. The
+ * events of each thread are copied under the lock of its buffer, then
+ * written out without holding it, so the traced threads are only held
+ * for the copy.
+ *
+ * @param path The path of the output file
+ * @return true on success, false otherwise
+ */
+bool Tracer::write(const std::string &path)
+{
+    std::lock_guard<std::mutex> lock(_mutex);
+    std::ofstream out(path, std::ios::trunc);
+    bool first = true;
+    char timestamp[32];
+
+    if (!out.is_open()) {
+        std::cerr << "Unable to open trace output: " << path << std::endl;
+        return false;
+    }
+    out << "{\"displayTimeUnit\": \"ns\", \"traceEvents\": [\n";
+    for (const auto &buffer : _buffers) {
+        std::vector<TraceEvent> events;
+        {
+            std::lock_guard<std::mutex> bufferLock(buffer->mutex);
+            std::uint64_t start = buffer->head > TRACE_BUFFER_SIZE ?
+                buffer->head - TRACE_BUFFER_SIZE : 0;
+            events.reserve(buffer->head - start);
+            for (std::uint64_t i = start; i < buffer->head; i++)
+                events.push_back(buffer->events[i % TRACE_BUFFER_SIZE]);
+        }
+        for (const TraceEvent &event : events) {
+            std::snprintf(timestamp, sizeof(timestamp), "%.3f",
+                event.timestamp / 1000.0);
+            out << (first ? "" : ",\n") << "{\"name\": \"";
+            for (const char *c = event.name; *c; c++)
+                out << ((*c == '"' || *c == '\\') ? '_' : *c);
+            out << "\", \"ph\": \"" << event.phase << "\", \"ts\": "
+                << timestamp << ", \"pid\": " << getpid()
+                << ", \"tid\": " << buffer->threadId << "}";
+            first = false;
+        }
+    }
+    out << "\n]}\n";
+    return out.good();
+}
+
+//////////////////////////////////// C ABI ////////////////////////////////////
+
+extern "C" {
+    /**
+     * @brief Record the beginning of a slice from a loaded library
+     *
+     * @param name The name of the slice
+     */
+    void arcade_trace_begin(const char *name)
+    {
+        Tracer::getInstance().begin(name);
+    }
+
+    /**
+     * @brief Record the end of a slice from a loaded library
+     *
+     * @param name The name of the slice
+     */
+    void arcade_trace_end(const char *name)
+    {
+        Tracer::getInstance().end(name);
+    }
+}
@@ -0,0 +1,76 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Tracer
+*/
+
+#ifndef TRACER_HPP_
+    #define TRACER_HPP_
+
+    #include <atomic>
+    #include <cstdint>
+    #include <memory>
+    #include <mutex>
+    #include <string>
+    #include <vector>
+
+    #define TRACE_BUFFER_SIZE (1 << 15)
+    #define TRACE_NAME_SIZE 48
+
+struct TraceEvent {
+    std::uint64_t timestamp;
+    char phase;
+    char name[TRACE_NAME_SIZE];
+};
+
+/**
+ * @brief Ring buffer of the trace events of one thread
+ *
+ * Only the owning thread writes into it. When it is full, the oldest
+ * events are overwritten. The mutex is held for each event and while the
+ * buffer is copied for a dump, so a dump never reads an event being
+ * written; outside of a dump it is never contended.
+ */
+struct TraceBuffer {
+    std::vector<TraceEvent> events;
+    std::uint64_t head = 0;
+    std::uint32_t threadId = 0;
+    std::mutex mutex;
+};
+
+/**
+ * @brief Process-wide tracer writing Chrome trace-event JSON
+ *
+ * Events are recorded into thread-local ring buffers with nanosecond
+ * timestamps and cost nothing but a flag check while tracing is off.
+ * Libraries emit events through the arcade_trace_begin and
+ * arcade_trace_end C functions exported by the core (see Trace.hpp).
+ */
+class Tracer {
+    public:
+        static Tracer &getInstance(void);
+
+        void setEnabled(bool enabled);
+        bool isEnabled(void) const;
+
+        void begin(const char *name);
+        void end(const char *name);
+
+        bool write(const std::string &path);
+
+    private:
+        Tracer() = default;
+        ~Tracer() = default;
+        Tracer(const Tracer &) = delete;
+        Tracer &operator=(const Tracer &) = delete;
+
+        void push(const char *name, char phase);
+        TraceBuffer &getThreadBuffer(void);
+
+        std::atomic<bool> _enabled{false};
+        std::mutex _mutex;
+        std::vector<std::unique_ptr<TraceBuffer>> _buffers;
+};
+
+#endif /* !TRACER_HPP_ */
@@ -0,0 +1,29 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** EventTime
+*/
+
+#ifndef EVENTTIME_HPP_
+    #define EVENTTIME_HPP_
+
+    #include <chrono>
+    #include <cstdint>
+
+/**
+ * @brief Get the time to stamp a RawEvent with
+ *
+ * The displays stamp their events on the steady clock, the one the core
+ * measures its frames with, so that the core can tell when an event
+ * happened within the session.
+ *
+ * @return std::uint64_t The time of the steady clock in microseconds
+ */
+inline std::uint64_t getEventTime(void)
+{
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+#endif /* !EVENTTIME_HPP_ */
@@ -8,6 +8,8 @@
 #ifndef ITYPE_HPP_
     #define ITYPE_HPP_
 
+    #include <cstdint>
+
 enum LibType {
     GAME,
     DISPLAY,
@@ -136,6 +138,10 @@ struct RawEvent {
     EventKey key;
     int x;
     int y;
+    // When the event happened, in microseconds, 0 if unknown. The displays
+    // stamp it with getEventTime() (EventTime.hpp), the core hands it to the
+    // games relative to the start of the session
+    std::uint64_t timestamp = 0;
 };
 
 struct Coordinates {
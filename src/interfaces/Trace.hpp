@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Trace
+*/
+
+#ifndef TRACE_HPP_
+    #define TRACE_HPP_
+
+    #include <dlfcn.h>
+
+extern "C" {
+    using TraceFunction = void (*)(const char *name);
+}
+
+/**
+ * @brief Emits a trace slice around a scope
+ *
+ * The slice is recorded by the tracer of the core through the
+ * arcade_trace_begin and arcade_trace_end functions it exports. They are
+ * looked up at runtime, so a library using this header can still be
+ * loaded by a program that does not provide them, in which case the
+ * scope does nothing.
+ */
+class TraceScope {
+    public:
+        explicit TraceScope(const char *name) : _name(name)
+        {
+            if (getBegin())
+                getBegin()(_name);
+        }
+
+        ~TraceScope()
+        {
+            if (getEnd())
+                getEnd()(_name);
+        }
+
+        TraceScope(const TraceScope &) = delete;
+        TraceScope &operator=(const TraceScope &) = delete;
+
+    private:
+        static TraceFunction getBegin(void)
+        {
+            static TraceFunction begin = reinterpret_cast<TraceFunction>(
+                dlsym(RTLD_DEFAULT, "arcade_trace_begin"));
+
+            return begin;
+        }
+
+        static TraceFunction getEnd(void)
+        {
+            static TraceFunction end = reinterpret_cast<TraceFunction>(
+                dlsym(RTLD_DEFAULT, "arcade_trace_end"));
+
+            return end;
+        }
+
+        const char *_name;
+};
+
+#endif /* !TRACE_HPP_ */
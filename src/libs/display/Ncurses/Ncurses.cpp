@@ -6,6 +6,7 @@
 */
 
 #include "Ncurses.hpp"
+#include "../../../interfaces/EventTime.hpp"
 
 static const std::unordered_map<int, EventKey> keyMap = {{KEY_UP, KEYBOARD_UP},
     {KEY_DOWN, KEYBOARD_DOWN}, {KEY_LEFT, KEYBOARD_LEFT},
@@ -141,6 +142,7 @@ RawEvent Ncurses::pollMouseEvent(MEVENT mouseEvent)
 
     event.x = mouseCoordinates.x;
     event.y = mouseCoordinates.y;
+    event.timestamp = getEventTime();
     if (mouseEvent.bstate & BUTTON1_PRESSED) {
         event.type = PRESS;
         event.key = MOUSE_LEFT;
@@ -183,6 +185,7 @@ RawEvent Ncurses::pollKeyboardEvent(int key)
     RawEvent keyEvent;
 
     keyEvent.type = PRESS;
+    keyEvent.timestamp = getEventTime();
     auto it = keyMap.find(key);
     if (it != keyMap.end()) {
         keyEvent.key = it->second;
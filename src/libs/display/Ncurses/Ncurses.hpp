@@ -8,7 +8,6 @@
 #ifndef NCURSES_HPP_
     #define NCURSES_HPP_
 
-    #include <SFML/Graphics.hpp>
     #include <iostream>
     #include <cstring>
     #include <cmath>
@@ -0,0 +1,344 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** NullDisplay
+*/
+
+#include "NullDisplay.hpp"
+#include "../../../interfaces/EventTime.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <unordered_map>
+
+static const std::unordered_map<std::string, EventKey> keyNames = {
+    {"MOUSE_LEFT", MOUSE_LEFT}, {"MOUSE_RIGHT", MOUSE_RIGHT},
+    {"MOUSE_MIDDLE", MOUSE_MIDDLE}, {"MOUSE_WHEEL_UP", MOUSE_WHEEL_UP},
+    {"MOUSE_WHEEL_DOWN", MOUSE_WHEEL_DOWN}, {"KEYBOARD_A", KEYBOARD_A},
+    {"KEYBOARD_B", KEYBOARD_B}, {"KEYBOARD_C", KEYBOARD_C},
+    {"KEYBOARD_D", KEYBOARD_D}, {"KEYBOARD_E", KEYBOARD_E},
+    {"KEYBOARD_F", KEYBOARD_F}, {"KEYBOARD_G", KEYBOARD_G},
+    {"KEYBOARD_H", KEYBOARD_H}, {"KEYBOARD_I", KEYBOARD_I},
+    {"KEYBOARD_J", KEYBOARD_J}, {"KEYBOARD_K", KEYBOARD_K},
+    {"KEYBOARD_L", KEYBOARD_L}, {"KEYBOARD_M", KEYBOARD_M},
+    {"KEYBOARD_N", KEYBOARD_N}, {"KEYBOARD_O", KEYBOARD_O},
+    {"KEYBOARD_P", KEYBOARD_P}, {"KEYBOARD_Q", KEYBOARD_Q},
+    {"KEYBOARD_R", KEYBOARD_R}, {"KEYBOARD_S", KEYBOARD_S},
+    {"KEYBOARD_T", KEYBOARD_T}, {"KEYBOARD_U", KEYBOARD_U},
+    {"KEYBOARD_V", KEYBOARD_V}, {"KEYBOARD_W", KEYBOARD_W},
+    {"KEYBOARD_X", KEYBOARD_X}, {"KEYBOARD_Y", KEYBOARD_Y},
+    {"KEYBOARD_Z", KEYBOARD_Z}, {"KEYBOARD_0", KEYBOARD_0},
+    {"KEYBOARD_1", KEYBOARD_1}, {"KEYBOARD_2", KEYBOARD_2},
+    {"KEYBOARD_3", KEYBOARD_3}, {"KEYBOARD_4", KEYBOARD_4},
+    {"KEYBOARD_5", KEYBOARD_5}, {"KEYBOARD_6", KEYBOARD_6},
+    {"KEYBOARD_7", KEYBOARD_7}, {"KEYBOARD_8", KEYBOARD_8},
+    {"KEYBOARD_9", KEYBOARD_9}, {"KEYBOARD_F1", KEYBOARD_F1},
+    {"KEYBOARD_F2", KEYBOARD_F2}, {"KEYBOARD_F3", KEYBOARD_F3},
+    {"KEYBOARD_F4", KEYBOARD_F4}, {"KEYBOARD_F5", KEYBOARD_F5},
+    {"KEYBOARD_F6", KEYBOARD_F6}, {"KEYBOARD_F7", KEYBOARD_F7},
+    {"KEYBOARD_F8", KEYBOARD_F8}, {"KEYBOARD_F9", KEYBOARD_F9},
+    {"KEYBOARD_F10", KEYBOARD_F10}, {"KEYBOARD_F11", KEYBOARD_F11},
+    {"KEYBOARD_F12", KEYBOARD_F12}, {"KEYBOARD_ESCAPE", KEYBOARD_ESCAPE},
+    {"KEYBOARD_ENTER", KEYBOARD_ENTER}, {"KEYBOARD_SPACE", KEYBOARD_SPACE},
+    {"KEYBOARD_BACKSPACE", KEYBOARD_BACKSPACE},
+    {"KEYBOARD_TAB", KEYBOARD_TAB}, {"KEYBOARD_UP", KEYBOARD_UP},
+    {"KEYBOARD_DOWN", KEYBOARD_DOWN}, {"KEYBOARD_LEFT", KEYBOARD_LEFT},
+    {"KEYBOARD_RIGHT", KEYBOARD_RIGHT}, {"KEYBOARD_LSHIFT", KEYBOARD_LSHIFT},
+    {"KEYBOARD_RSHIFT", KEYBOARD_RSHIFT}, {"KEYBOARD_LCTRL", KEYBOARD_LCTRL},
+    {"KEYBOARD_RCTRL", KEYBOARD_RCTRL}, {"KEYBOARD_LALT", KEYBOARD_LALT},
+    {"KEYBOARD_RALT", KEYBOARD_RALT}, {"KEYBOARD_HOME", KEYBOARD_HOME},
+    {"KEYBOARD_END", KEYBOARD_END}, {"KEYBOARD_DELETE", KEYBOARD_DELETE},
+    {"KEYBOARD_INSERT", KEYBOARD_INSERT},
+    {"KEYBOARD_PAGEUP", KEYBOARD_PAGEUP},
+    {"KEYBOARD_PAGEDOWN", KEYBOARD_PAGEDOWN},
+    {"KEYBOARD_MINUS", KEYBOARD_MINUS}, {"KEYBOARD_PLUS", KEYBOARD_PLUS},
+    {"KEYBOARD_COMMA", KEYBOARD_COMMA}, {"KEYBOARD_PERIOD", KEYBOARD_PERIOD},
+    {"KEYBOARD_SLASH", KEYBOARD_SLASH},
+    {"KEYBOARD_SEMICOLON", KEYBOARD_SEMICOLON},
+    {"KEYBOARD_APOSTROPHE", KEYBOARD_APOSTROPHE},
+    {"KEYBOARD_BACKSLASH", KEYBOARD_BACKSLASH},
+    {"KEYBOARD_GRAVE", KEYBOARD_GRAVE},
+    {"KEYBOARD_LBRACKET", KEYBOARD_LBRACKET},
+    {"KEYBOARD_RBRACKET", KEYBOARD_RBRACKET}};
+
+static const std::unordered_map<std::string, EventType> typeNames = {
+    {"PRESS", PRESS}, {"RELEASE", RELEASE}, {"QUIT", QUIT}};
+
+static const char *shapeNames[MUSIC + 1] = {
+    "rectangle", "circle", "text", "music"};
+
+/**
+ * @brief Construct a new NullDisplay object
+ *
+ * Reads its configuration from the environment.
+ *
+ * @throw std::runtime_error if the event script cannot be read
+ */
+NullDisplay::NullDisplay()
+{
+    const char *events = std::getenv(NULL_EVENTS_ENV);
+    const char *dtype = std::getenv(NULL_DTYPE_ENV);
+    const char *frames = std::getenv(NULL_FRAMES_ENV);
+
+    if (dtype && std::strcmp(dtype, "terminal") == 0)
+        _dtype = TERMINAL;
+    if (frames)
+        _maxFrames = std::strtoull(frames, nullptr, 10);
+    if (events)
+        loadScript(events);
+}
+
+/**
+ * @brief Destroy the NullDisplay object and report its statistics
+ */
+NullDisplay::~NullDisplay()
+{
+    writeStats();
+}
+
+//---------------------------------- Script ----------------------------------//
+
+/**
+ * @brief Parse one line of the event script
+ *
+ * @param line The line to parse
+ * @param scripted The parsed event
+ * @return true if the line holds an event
+ */
+bool NullDisplay::parseScriptLine(
+    const std::string &line, ScriptedEvent &scripted)
+{
+    std::istringstream stream(line);
+    std::string type;
+    std::string key;
+
+    if (!(stream >> scripted.frame >> type))
+        return false;
+    if (typeNames.find(type) == typeNames.end())
+        return false;
+    scripted.event.type = typeNames.at(type);
+    scripted.event.key = MOUSE_LEFT;
+    scripted.event.x = 0;
+    scripted.event.y = 0;
+    if (scripted.event.type == QUIT)
+        return true;
+    if (!(stream >> key) || keyNames.find(key) == keyNames.end())
+        return false;
+    scripted.event.key = keyNames.at(key);
+    stream >> scripted.event.x >> scripted.event.y;
+    return true;
+}
+
+/**
+ * @brief Load the scripted events
+ *
+ * Empty lines and lines starting with '#' are ignored. The events are
+ * sorted by frame, keeping the order of the file within a frame.
+ *
+ * @param path The path of the script
+ * @throw std::runtime_error if the file cannot be opened or is invalid
+ */
+void NullDisplay::loadScript(const std::string &path)
+{
+    std::ifstream file(path);
+    std::string line;
+    ScriptedEvent scripted;
+    std::size_t lineNumber = 0;
+
+    if (!file.is_open())
+        throw std::runtime_error("Unable to open event script: " + path);
+    while (std::getline(file, line)) {
+        lineNumber++;
+        if (line.empty() || line[0] == '#')
+            continue;
+        if (!parseScriptLine(line, scripted))
+            throw std::runtime_error("Invalid event at " + path + ":" +
+                std::to_string(lineNumber));
+        _script.push_back(scripted);
+    }
+    std::stable_sort(_script.begin(), _script.end(),
+        [](const auto &a, const auto &b) { return a.frame < b.frame; });
+}
+
+//--------------------------------- Display ---------------------------------//
+
+/**
+ * @brief Feed the scripted events of the current frame
+ *
+ * @return std::vector<RawEvent> The events scripted for this frame, plus
+ * QUIT once ARCADE_NULL_FRAMES frames have been polled
+ */
+std::vector<RawEvent> NullDisplay::pollEvent(void)
+{
+    std::vector<RawEvent> events;
+
+    while (_nextEvent < _script.size() &&
+        _script[_nextEvent].frame <= _polls) {
+        events.push_back(_script[_nextEvent].event);
+        events.back().timestamp = getEventTime();
+        _nextEvent++;
+    }
+    _polls++;
+    if (_maxFrames != 0 && _polls >= _maxFrames)
+        events.push_back({QUIT, MOUSE_LEFT, 0, 0, getEventTime()});
+    return events;
+}
+
+/**
+ * @brief Fold data into a FNV-1a checksum
+ *
+ * @param checksum The current checksum
+ * @param data The data to fold
+ * @param size The size of the data
+ * @return std::uint64_t The new checksum
+ */
+std::uint64_t NullDisplay::hash(
+    std::uint64_t checksum, const void *data, std::size_t size)
+{
+    const unsigned char *bytes = static_cast<const unsigned char *>(data);
+
+    for (std::size_t i = 0; i < size; i++) {
+        checksum ^= bytes[i];
+        checksum *= FNV_PRIME;
+    }
+    return checksum;
+}
+
+/**
+ * @brief Count and checksum an object instead of drawing it
+ *
+ * @param obj The object to draw
+ */
+void NullDisplay::drawObject(renderObject obj)
+{
+    int fields[9] = {obj.x, obj.y, obj.width, obj.height, obj.rotate,
+        obj.RGB[0], obj.RGB[1], obj.RGB[2], static_cast<int>(obj.type)};
+
+    if (obj.type >= RECTANGLE && obj.type <= MUSIC)
+        _drawCalls[obj.type]++;
+    _frameChecksum = hash(_frameChecksum, fields, sizeof(fields));
+    _frameChecksum =
+        hash(_frameChecksum, obj.sprite.data(), obj.sprite.size());
+}
+
+/**
+ * @brief Start a new frame
+ */
+void NullDisplay::clear(void)
+{
+    _frameChecksum = FNV_OFFSET_BASIS;
+}
+
+/**
+ * @brief End the frame and fold its checksum into the run checksum
+ */
+void NullDisplay::display(void)
+{
+    _lastFrameChecksum = _frameChecksum;
+    _checksum = hash(_checksum, &_lastFrameChecksum, sizeof(_lastFrameChecksum));
+    _frameChecksum = FNV_OFFSET_BASIS;
+    _frames++;
+}
+
+/**
+ * @brief Get the name of the display library
+ *
+ * @return std::string The name of the library
+ */
+std::string NullDisplay::getName(void)
+{
+    return LIBRARY_NAME;
+}
+
+/**
+ * @brief Get the type of the display
+ *
+ * @return DisplayType GRAPHICAL, or TERMINAL if ARCADE_NULL_DTYPE is
+ * "terminal"
+ */
+DisplayType NullDisplay::getDType(void)
+{
+    return _dtype;
+}
+
+//---------------------------------- Stats ----------------------------------//
+
+/**
+ * @brief Write the statistics of the run
+ *
+ * They are written as JSON to ARCADE_NULL_STATS if it is set, and to the
+ * error output otherwise.
+ */
+void NullDisplay::writeStats(void)
+{
+    const char *path = std::getenv(NULL_STATS_ENV);
+    std::ofstream file;
+    std::ostream &out = path ? file : std::cerr;
+
+    if (path) {
+        file.open(path, std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "Unable to open null display stats: " << path
+                      << std::endl;
+            return;
+        }
+    }
+    out << "{\"polls\": " << _polls << ", \"frames\": " << _frames
+        << ", \"drawCalls\": {";
+    for (int i = RECTANGLE; i <= MUSIC; i++)
+        out << (i ? ", " : "") << "\"" << shapeNames[i]
+            << "\": " << _drawCalls[i];
+    out << "}, \"lastFrameChecksum\": \"" << std::hex << _lastFrameChecksum
+        << "\", \"checksum\": \"" << _checksum << std::dec << "\"}"
+        << std::endl;
+}
+
+extern "C"
+{
+    /**
+     * @brief Constructor for the shared library.
+     */
+    __attribute__((constructor)) void constructor()
+    {
+    }
+
+    /**
+     * @brief Destructor for the shared library.
+     */
+    __attribute__((destructor)) void destructor()
+    {
+    }
+
+    /**
+     * @brief Entry point for the null display library.
+     * @return A pointer to a new NullDisplay instance.
+     */
+    NullDisplay *DisplayEntryPoint(void)
+    {
+        return new NullDisplay();
+    }
+
+    /**
+     * @brief Retrieves the name of the display library.
+     * @return A string representing the name of the library.
+     */
+    std::string getName(void)
+    {
+        return LIBRARY_NAME;
+    }
+
+    /**
+     * @brief Retrieves the type of the library.
+     * @return The type of the library (DISPLAY).
+     */
+    LibType getType(void)
+    {
+        return DISPLAY;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** NullDisplay
+*/
+
+#ifndef NULLDISPLAY_HPP_
+    #define NULLDISPLAY_HPP_
+
+    #include <array>
+    #include <cstdint>
+    #include <string>
+    #include <vector>
+
+    #include "../interfaces/IDisplay.hpp"
+
+    #define LIBRARY_NAME "Null"
+
+    #define NULL_EVENTS_ENV "ARCADE_NULL_EVENTS"
+    #define NULL_DTYPE_ENV "ARCADE_NULL_DTYPE"
+    #define NULL_FRAMES_ENV "ARCADE_NULL_FRAMES"
+    #define NULL_STATS_ENV "ARCADE_NULL_STATS"
+
+    #define FNV_OFFSET_BASIS 14695981039346656037ULL
+    #define FNV_PRIME 1099511628211ULL
+
+/**
+ * @brief Headless display for benchmarks and CI
+ *
+ * It draws nothing: every renderObject is folded into a checksum and
+ * counted by shape. Its behaviour is configured through the environment
+ * since the entry point takes no argument:
+ *  - ARCADE_NULL_EVENTS: script of RawEvents to feed to the core, one
+ *    "<frame> <PRESS|RELEASE|QUIT> [key] [x y]" per line
+ *  - ARCADE_NULL_DTYPE: "terminal" to get the terminal sprites
+ *  - ARCADE_NULL_FRAMES: send QUIT after this number of frames
+ *  - ARCADE_NULL_STATS: write the statistics as JSON to this file
+ *    instead of the error output
+ */
+class NullDisplay : public IDisplay {
+    public:
+        NullDisplay();
+        ~NullDisplay();
+
+        std::vector<RawEvent> pollEvent(void) final;
+        void drawObject(renderObject) final;
+        void clear(void) final;
+        void display(void) final;
+
+        std::string getName(void) final;
+        DisplayType getDType(void) final;
+
+    protected:
+        struct ScriptedEvent {
+            std::uint64_t frame;
+            RawEvent event;
+        };
+
+        void loadScript(const std::string &path);
+        bool parseScriptLine(const std::string &line, ScriptedEvent &scripted);
+        static std::uint64_t hash(
+            std::uint64_t checksum, const void *data, std::size_t size);
+        void writeStats(void);
+
+    private:
+        DisplayType _dtype = GRAPHICAL;
+        std::vector<ScriptedEvent> _script;
+        std::size_t _nextEvent = 0;
+        std::uint64_t _polls = 0;
+        std::uint64_t _frames = 0;
+        std::uint64_t _maxFrames = 0;
+        std::array<std::uint64_t, MUSIC + 1> _drawCalls = {};
+        std::uint64_t _frameChecksum = FNV_OFFSET_BASIS;
+        std::uint64_t _lastFrameChecksum = 0;
+        std::uint64_t _checksum = FNV_OFFSET_BASIS;
+};
+
+#endif /* !NULLDISPLAY_HPP_ */
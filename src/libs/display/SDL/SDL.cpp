@@ -6,10 +6,13 @@
 */
 
 #include "SDL.hpp"
+#include "../../../interfaces/EventTime.hpp"
+#include "../../../interfaces/Trace.hpp"
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <SDL2/SDL_image.h>
 #include <SDL2/SDL_mixer.h>
+#include <algorithm>
 #include <iostream>
 #include <unordered_map>
 
@@ -231,6 +234,12 @@ void SDL::renderPresent(void)
 std::vector<RawEvent> SDL::pollEvent(void)
 {
     SDL_Event event;
+    std::uint64_t now = getEventTime();
+    Uint32 ticks = SDL_GetTicks();
+    // SDL stamps its events in milliseconds since its start
+    auto stamp = [now, ticks](Uint32 time) {
+        return now - static_cast<std::uint64_t>(ticks - std::min(time, ticks)) * 1000;
+    };
     _hasEvent = false;
 
     _event.clear();
@@ -239,10 +248,12 @@ std::vector<RawEvent> SDL::pollEvent(void)
         if (event.type == SDL_QUIT) {
             RawEvent quitEvent;
             quitEvent.type = EventType::QUIT;
+            quitEvent.timestamp = stamp(event.common.timestamp);
             _event.push_back(quitEvent);
         } else if (event.type == SDL_KEYDOWN) {
             RawEvent keyEvent;
             keyEvent.type = EventType::PRESS;
+            keyEvent.timestamp = stamp(event.common.timestamp);
             auto it = eventTypeMap.find(event.key.keysym.sym);
             if (it != eventTypeMap.end()) {
                 keyEvent.key = it->second;
@@ -251,6 +262,7 @@ std::vector<RawEvent> SDL::pollEvent(void)
         } else if (event.type == SDL_MOUSEBUTTONDOWN) {
             RawEvent mouseEvent;
             mouseEvent.type = EventType::PRESS;
+            mouseEvent.timestamp = stamp(event.common.timestamp);
             auto it = eventTypeMap.find(event.button.button);
             if (it != eventTypeMap.end()) {
                 mouseEvent.key = it->second;
@@ -261,6 +273,7 @@ std::vector<RawEvent> SDL::pollEvent(void)
         } else if (event.type == SDL_KEYUP) {
             RawEvent keyEvent;
             keyEvent.type = EventType::RELEASE;
+            keyEvent.timestamp = stamp(event.common.timestamp);
             auto it = eventTypeMap.find(event.key.keysym.sym);
             if (it != eventTypeMap.end()) {
                 keyEvent.key = it->second;
@@ -269,6 +282,7 @@ std::vector<RawEvent> SDL::pollEvent(void)
         } else if (event.type == SDL_MOUSEBUTTONUP) {
             RawEvent mouseEvent;
             mouseEvent.type = EventType::RELEASE;
+            mouseEvent.timestamp = stamp(event.common.timestamp);
             auto it = eventTypeMap.find(event.button.button);
             if (it != eventTypeMap.end()) {
                 mouseEvent.key = it->second;
@@ -362,7 +376,11 @@ void SDL::drawRectangle(renderObject obj)
 
     SDL_SetRenderDrawColor(_renderer, obj.RGB[0], obj.RGB[1], obj.RGB[2], 255);
     if (!obj.sprite.empty()) {
-        SDL_Surface *surface = IMG_Load(obj.sprite.c_str());
+        SDL_Surface *surface = nullptr;
+        {
+            TraceScope trace("IMG_Load");
+            surface = IMG_Load(obj.sprite.c_str());
+        }
         if (!surface) {
             std::cerr << "IMG_Load Error: " << IMG_GetError() << std::endl;
             return;
@@ -419,7 +437,11 @@ void SDL::drawCircle(renderObject obj)
  */
 void SDL::drawText(renderObject obj)
 {
-    TTF_Font *font = TTF_OpenFont("assets/Tahoma.ttf", obj.width);
+    TTF_Font *font = nullptr;
+    {
+        TraceScope trace("TTF_OpenFont");
+        font = TTF_OpenFont("assets/Tahoma.ttf", obj.width);
+    }
     if (!font) {
         std::cerr << "TTF_OpenFont Error: " << TTF_GetError() << std::endl;
         return;
@@ -6,6 +6,7 @@
 */
 
 #include "libSDL.hpp"
+#include <cstring>
 
 /**
  * @brief Constructor for the LibSDL class.
@@ -14,13 +15,18 @@
  * to an SDL object. It sets up an SDL window with the title "Arcade", centered
  * on the screen, with a resolution of 1024x768 pixels, and makes it visible.
  * Additionally, it creates an SDL renderer for the window with hardware
- * acceleration enabled.
+ * acceleration enabled, or a software one with the "dummy" video driver
+ * (SDL_VIDEODRIVER=dummy) used to run offscreen.
  */
 LibSDL::LibSDL()
 {
     _sdl = std::make_unique<SDL>();
     _sdl->createWindow("Arcade", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, 1024, 768, SDL_WINDOW_SHOWN);
-    _sdl->createRenderer(-1, SDL_RENDERER_ACCELERATED);
+    const char *driver = SDL_GetCurrentVideoDriver();
+    if (driver && std::strcmp(driver, "dummy") == 0)
+        _sdl->createRenderer(-1, SDL_RENDERER_SOFTWARE);
+    else
+        _sdl->createRenderer(-1, SDL_RENDERER_ACCELERATED);
 }
 
 /**
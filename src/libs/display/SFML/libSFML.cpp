@@ -6,14 +6,28 @@
 */
 
 #include "libSFML.hpp"
+#include <cstdlib>
+#include <stdexcept>
+#include "../../../interfaces/EventTime.hpp"
+#include "../../../interfaces/Trace.hpp"
 
 /**
  * @brief Constructor for the libSFML class.
+ *
+ * When ARCADE_SFML_OFFSCREEN is set, the objects are drawn into a texture
+ * and no window is opened, so the display can be measured without a
+ * graphical session nor a frame rate limit.
  */
 libSFML::libSFML()
 {
     _name = LIBRARY_NAME;
     _dtype = LIBRARY_DTYPE;
+    if (std::getenv(SFML_OFFSCREEN_ENV)) {
+        if (!_offscreen.create(1024, 768))
+            throw std::runtime_error("Failed to create the offscreen texture");
+        _target = &_offscreen;
+        return;
+    }
     this->_window.create(sf::VideoMode(1024, 768), "Arcade", sf::Style::Titlebar | sf::Style::Close);
     this->_window.setFramerateLimit(60);
 }
@@ -37,6 +51,7 @@ std::vector<RawEvent> libSFML::pollEvent(void)
     while (_window.pollEvent(event))
     {
         RawEvent raw;
+        raw.timestamp = getEventTime();
         switch (event.type)
         {
             case sf::Event::Closed:
@@ -274,6 +289,7 @@ void libSFML::drawRectangle(renderObject obj)
     if (!obj.sprite.empty()) {
         if (textureCache.find(obj.sprite) == textureCache.end()) {
             sf::Texture texture;
+            TraceScope trace("Texture::loadFromFile");
             if (texture.loadFromFile(obj.sprite)) {
                 textureCache[obj.sprite] = texture;
             }
@@ -287,7 +303,7 @@ void libSFML::drawRectangle(renderObject obj)
         rectangle.setFillColor(sf::Color(obj.RGB[0], obj.RGB[1], obj.RGB[2]));
     }
 
-    _window.draw(rectangle);
+    _target->draw(rectangle);
 }
 
 
@@ -299,7 +315,7 @@ void libSFML::drawCircle(renderObject obj)
 {
     sf::CircleShape circle(obj.width);
     circle.setPosition(obj.x, obj.y);
-    _window.draw(circle);
+    _target->draw(circle);
 }
 
 /**
@@ -310,13 +326,16 @@ void libSFML::drawText(renderObject obj)
 {
     sf::Text text;
     sf::Font font;
-    font.loadFromFile("./assets/Tahoma.ttf");
+    {
+        TraceScope trace("Font::loadFromFile");
+        font.loadFromFile("./assets/Tahoma.ttf");
+    }
     text.setFont(font);
     text.setString(obj.sprite);
     text.setCharacterSize(obj.width);
     text.setPosition(obj.x, obj.y);
     text.setFillColor(sf::Color(obj.RGB[0], obj.RGB[1], obj.RGB[2]));
-    _window.draw(text);
+    _target->draw(text);
 }
 
 /**
@@ -405,7 +424,7 @@ void libSFML::playSoundEffect(const std::string& filePath,
  */
 void libSFML::clear(void)
 {
-    _window.clear();
+    _target->clear();
 }
 
 /**
@@ -413,7 +432,10 @@ void libSFML::clear(void)
  */
 void libSFML::display(void)
 {
-    _window.display();
+    if (_target == &_offscreen)
+        _offscreen.display();
+    else
+        _window.display();
 }
 
 /**
@@ -19,6 +19,9 @@
     #define LIBRARY_NAME "SFML"
     #define LIBRARY_DTYPE DisplayType::GRAPHICAL
 
+    // Render into a texture instead of a window, for the benchmarks
+    #define SFML_OFFSCREEN_ENV "ARCADE_SFML_OFFSCREEN"
+
 class libSFML : public IDisplay {
     public:
         libSFML();
@@ -44,6 +47,8 @@ class libSFML : public IDisplay {
         std::string _name;
         DisplayType _dtype;
         sf::RenderWindow _window;
+        sf::RenderTexture _offscreen;
+        sf::RenderTarget *_target = &_window;
 
         sf::Music _music;
 };
@@ -1,19 +1,17 @@
 #include "Jumpman.hpp"
 #include <iostream>
 #include <algorithm>
-#include <chrono>
+#include <cmath>
 
 constexpr float GRAVITY = 980.0f;
-constexpr int GROUND_OFFSET = 154;
+// Margin keeping a box that touches a tile from overlapping it.
+constexpr float COLLISION_EPSILON = 0.01f;
 
 Jumpman::Jumpman()
     : _marioSpeed(150.0f)
 {
-    _marioX = 0;
-    _marioY = SCREEN_HEIGHT - GROUND_OFFSET;
-    _marioVelocityX = 0;
-    _marioVelocityY = 0;
-    _lastUpdateTime = std::chrono::steady_clock::now();
+    loadCollisionFromImage(JUMPMAN_COLLISION_MAP);
+    spawn();
 }
 
 Jumpman::~Jumpman()
@@ -74,8 +72,8 @@ void Jumpman::handleEvent(std::vector<RawEvent> events)
             else if (event.key == EventKey::KEYBOARD_D)
                 _marioVelocityX = _marioSpeed;
             else if (event.key == EventKey::KEYBOARD_SPACE) {
-                if (_marioY >= (SCREEN_HEIGHT - GROUND_OFFSET))
-                    _marioVelocityY = -_marioSpeed - 350;
+                if (collisionAt(_marioX, _marioY + 1))
+                    _marioVelocityY = -JUMPMAN_JUMP_SPEED;
             }
             else if (event.key == EventKey::KEYBOARD_S)
                 _marioVelocityY = _marioSpeed;
@@ -89,19 +87,20 @@ void Jumpman::handleEvent(std::vector<RawEvent> events)
 }
 
 /**
- * @brief Updates Mario's movement, applies gravity and returns game entities.
+ * @brief Returns the game entities, Mario drawn between his last two
+ * positions.
  *
  * @return A map of entity names to their corresponding Entity structures.
  */
 std::map<std::string, Entity> Jumpman::renderGame()
 {
-    updateMovement();
+    auto [marioX, marioY] = getDrawnPosition();
     std::map<std::string, Entity> entities;
     entities["background"] = printBackGround();
     Entity mario = createEntity(
         Shape::RECTANGLE,
-        0, 0, 50, 50,
-        static_cast<int>(_marioX), static_cast<int>(_marioY),
+        0, 0, JUMPMAN_SIZE, JUMPMAN_SIZE,
+        static_cast<int>(marioX - getCameraX()), static_cast<int>(marioY),
         {
             {DisplayType::TERMINAL, "M"},
             {DisplayType::GRAPHICAL, "assets/jumpman/mario.png"}
@@ -142,22 +141,306 @@ void Jumpman::setUsername(std::string username)
     (void) username;
 }
 
+/**
+ * @brief Sets the seed of the random generator.
+ *
+ * Jumpman does not use randomness.
+ *
+ * @param seed The seed to use.
+ */
+void Jumpman::setSeed(std::uint64_t seed)
+{
+    (void) seed;
+}
+
+/**
+ * @brief The movement runs on the fixed steps, the frame time is unused.
+ *
+ * @param dt The time elapsed since the previous frame, in seconds.
+ */
+void Jumpman::update(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief Moves Mario by one fixed step.
+ *
+ * @param dt The duration of the step, in seconds.
+ */
+void Jumpman::fixedUpdate(double dt)
+{
+    _previousX = _marioX;
+    _previousY = _marioY;
+    updateMovement(static_cast<float>(dt));
+}
+
+/**
+ * @brief Sets how far Mario is drawn between his last two positions.
+ *
+ * @param alpha The share of a step since the last one.
+ */
+void Jumpman::setInterpolation(double alpha)
+{
+    _interpolation = static_cast<float>(alpha);
+}
+
+/**
+ * @brief Gets the position Mario is drawn at, between his last two
+ * positions.
+ *
+ * @return The x and y coordinates.
+ */
+std::pair<float, float> Jumpman::getDrawnPosition(void) const
+{
+    return {_previousX + (_marioX - _previousX) * _interpolation,
+        _previousY + (_marioY - _previousY) * _interpolation};
+}
+
+/**
+ * @brief Gets the width of the level, as read from the collision map.
+ *
+ * @return The width of the level, in screen pixels.
+ */
+float Jumpman::getLevelWidth(void) const
+{
+    return _tiles.getColumns() * _tiles.getTileSize() * _worldScale;
+}
+
+/**
+ * @brief Gets the left of the part of the level on screen, following
+ * Mario.
+ *
+ * @return The x coordinate of the camera, in screen pixels.
+ */
+float Jumpman::getCameraX(void) const
+{
+    float levelWidth = getLevelWidth();
+    float cameraX = getDrawnPosition().first + JUMPMAN_SIZE / 2.0f -
+        SCREEN_WIDTH / 2.0f;
+
+    return std::clamp(cameraX, 0.0f, std::max(0.0f, levelWidth - SCREEN_WIDTH));
+}
+
 /**
  * @brief Updates Mario's position using delta time and applies gravity.
+ *
+ * Mario is moved along x then along y, each move stopping at the first
+ * solid tile or block on the way. Falling out of the level puts him back
+ * at the start.
+ *
+ * @param deltaTime The duration of the step, in seconds.
  */
-void Jumpman::updateMovement()
-{
-    auto now = std::chrono::steady_clock::now();
-    std::chrono::duration<float> deltaTime = now - _lastUpdateTime;
-    _lastUpdateTime = now;
-    _marioVelocityY += GRAVITY * deltaTime.count();
-    _marioX += _marioVelocityX * deltaTime.count();
-    _marioY += _marioVelocityY * deltaTime.count();
-    float groundLevel = static_cast<float>(SCREEN_HEIGHT - GROUND_OFFSET);
-    if (_marioY > groundLevel) {
-        _marioY = groundLevel;
+void Jumpman::updateMovement(float deltaTime)
+{
+    _marioVelocityY = std::min(_marioVelocityY + GRAVITY * deltaTime,
+        static_cast<float>(JUMPMAN_MAX_FALL_SPEED));
+    moveHorizontally(_marioVelocityX * deltaTime);
+    if (moveVertically(_marioVelocityY * deltaTime))
         _marioVelocityY = 0;
+    if (_marioY > SCREEN_HEIGHT)
+        spawn();
+}
+
+/**
+ * @brief Moves Mario along x, up to the first obstacle swept by his box.
+ *
+ * Only the columns of tiles between his side and its destination are
+ * tested, so the cost does not depend on the length of the level.
+ *
+ * @param dx The distance to move, in screen pixels.
+ * @return true if Mario was stopped.
+ */
+bool Jumpman::moveHorizontally(float dx)
+{
+    float tile = _tiles.getTileSize() * _worldScale;
+    float target = _marioX + dx;
+    int row0 = static_cast<int>(std::floor(_marioY / tile));
+    int row1 = static_cast<int>(std::floor((_marioY + JUMPMAN_SIZE -
+        COLLISION_EPSILON) / tile));
+    bool isStopped = false;
+
+    if (dx == 0)
+        return false;
+    if (dx > 0) {
+        int from = static_cast<int>(std::floor((_marioX + JUMPMAN_SIZE -
+            COLLISION_EPSILON) / tile)) + 1;
+        int to = static_cast<int>(std::floor((target + JUMPMAN_SIZE -
+            COLLISION_EPSILON) / tile));
+        for (int column = from; column <= to && !isStopped; column++) {
+            if (_tiles.isAreaSolid(column, row0, column, row1)) {
+                target = column * tile - JUMPMAN_SIZE;
+                isStopped = true;
+            }
+        }
+    } else {
+        int from = static_cast<int>(std::floor(_marioX / tile)) - 1;
+        int to = static_cast<int>(std::floor(target / tile));
+        for (int column = from; column >= to && !isStopped; column--) {
+            if (_tiles.isAreaSolid(column, row0, column, row1)) {
+                target = (column + 1) * tile;
+                isStopped = true;
+            }
+        }
+    }
+    for (const Entity &block : _collisionBlocks) {
+        if (_marioY >= block.y + block.height || _marioY + JUMPMAN_SIZE <= block.y)
+            continue;
+        if (dx > 0 && block.x >= _marioX + JUMPMAN_SIZE - COLLISION_EPSILON &&
+            block.x < target + JUMPMAN_SIZE) {
+            target = block.x - JUMPMAN_SIZE;
+            isStopped = true;
+        } else if (dx < 0 && block.x + block.width <= _marioX + COLLISION_EPSILON &&
+            block.x + block.width > target) {
+            target = block.x + block.width;
+            isStopped = true;
+        }
+    }
+    _marioX = target;
+    return isStopped;
+}
+
+/**
+ * @brief Moves Mario along y, up to the first obstacle swept by his box.
+ *
+ * @param dy The distance to move, in screen pixels.
+ * @return true if Mario landed or hit a ceiling.
+ */
+bool Jumpman::moveVertically(float dy)
+{
+    float tile = _tiles.getTileSize() * _worldScale;
+    float target = _marioY + dy;
+    int column0 = static_cast<int>(std::floor(_marioX / tile));
+    int column1 = static_cast<int>(std::floor((_marioX + JUMPMAN_SIZE -
+        COLLISION_EPSILON) / tile));
+    bool isStopped = false;
+
+    if (dy == 0)
+        return false;
+    if (dy > 0) {
+        int from = static_cast<int>(std::floor((_marioY + JUMPMAN_SIZE -
+            COLLISION_EPSILON) / tile)) + 1;
+        int to = static_cast<int>(std::floor((target + JUMPMAN_SIZE -
+            COLLISION_EPSILON) / tile));
+        for (int row = from; row <= to && !isStopped; row++) {
+            if (_tiles.isAreaSolid(column0, row, column1, row)) {
+                target = row * tile - JUMPMAN_SIZE;
+                isStopped = true;
+            }
+        }
+    } else {
+        int from = static_cast<int>(std::floor(_marioY / tile)) - 1;
+        int to = static_cast<int>(std::floor(target / tile));
+        for (int row = from; row >= to && !isStopped; row--) {
+            if (_tiles.isAreaSolid(column0, row, column1, row)) {
+                target = (row + 1) * tile;
+                isStopped = true;
+            }
+        }
+    }
+    for (const Entity &block : _collisionBlocks) {
+        if (_marioX >= block.x + block.width || _marioX + JUMPMAN_SIZE <= block.x)
+            continue;
+        if (dy > 0 && block.y >= _marioY + JUMPMAN_SIZE - COLLISION_EPSILON &&
+            block.y < target + JUMPMAN_SIZE) {
+            target = block.y - JUMPMAN_SIZE;
+            isStopped = true;
+        } else if (dy < 0 && block.y + block.height <= _marioY + COLLISION_EPSILON &&
+            block.y + block.height > target) {
+            target = block.y + block.height;
+            isStopped = true;
+        }
     }
+    _marioY = target;
+    return isStopped;
+}
+
+/**
+ * @brief Checks if Mario's box would overlap a solid tile or block.
+ *
+ * @param newX The x coordinate to test, in screen pixels.
+ * @param newY The y coordinate to test, in screen pixels.
+ * @return true if the box collides.
+ */
+bool Jumpman::collisionAt(float newX, float newY)
+{
+    float tile = _tiles.getTileSize() * _worldScale;
+    int column0 = static_cast<int>(std::floor(newX / tile));
+    int row0 = static_cast<int>(std::floor(newY / tile));
+    int column1 = static_cast<int>(std::floor((newX + JUMPMAN_SIZE -
+        COLLISION_EPSILON) / tile));
+    int row1 = static_cast<int>(std::floor((newY + JUMPMAN_SIZE -
+        COLLISION_EPSILON) / tile));
+
+    if (_tiles.isAreaSolid(column0, row0, column1, row1))
+        return true;
+    for (const Entity &block : _collisionBlocks) {
+        if (checkCollision(newX, newY, block))
+            return true;
+    }
+    return false;
+}
+
+/**
+ * @brief Checks if Mario's box at a position overlaps a block.
+ *
+ * @param x The x coordinate of Mario, in screen pixels.
+ * @param y The y coordinate of Mario, in screen pixels.
+ * @param block The block to test.
+ * @return true if the boxes overlap.
+ */
+bool Jumpman::checkCollision(float x, float y, const Entity &block)
+{
+    return x < block.x + block.width && x + JUMPMAN_SIZE > block.x &&
+        y < block.y + block.height && y + JUMPMAN_SIZE > block.y;
+}
+
+/**
+ * @brief Loads the solid tiles of the level from a BMP image.
+ *
+ * The image is read once into a tile map. When it cannot be read, the
+ * level is a flat floor.
+ *
+ * @param path The path of the image.
+ */
+void Jumpman::loadCollisionFromImage(const std::string &path)
+{
+    if (!_tiles.loadBmp(path, JUMPMAN_TILE_SIZE)) {
+        _tiles.reset(JUMPMAN_LEVEL_WIDTH / JUMPMAN_TILE_SIZE,
+            JUMPMAN_LEVEL_HEIGHT / JUMPMAN_TILE_SIZE, JUMPMAN_TILE_SIZE);
+        for (int row = JUMPMAN_FALLBACK_GROUND / JUMPMAN_TILE_SIZE;
+            row < _tiles.getRows(); row++) {
+            for (int column = 0; column < _tiles.getColumns(); column++)
+                _tiles.setSolid(column, row);
+        }
+    }
+    _worldScale = static_cast<float>(SCREEN_HEIGHT) /
+        (_tiles.getRows() * _tiles.getTileSize());
+}
+
+/**
+ * @brief Puts Mario at the start of the level, standing on the first
+ * solid tile under JUMPMAN_SPAWN_X.
+ */
+void Jumpman::spawn(void)
+{
+    float tile = _tiles.getTileSize() * _worldScale;
+    int column0 = static_cast<int>(std::floor(JUMPMAN_SPAWN_X / tile));
+    int column1 = static_cast<int>(std::floor((JUMPMAN_SPAWN_X + JUMPMAN_SIZE -
+        COLLISION_EPSILON) / tile));
+
+    _marioX = JUMPMAN_SPAWN_X;
+    _marioY = 0;
+    for (int row = 0; row < _tiles.getRows(); row++) {
+        if (_tiles.isAreaSolid(column0, row, column1, row)) {
+            _marioY = std::max(0.0f, row * tile - JUMPMAN_SIZE);
+            break;
+        }
+    }
+    _marioVelocityX = 0;
+    _marioVelocityY = 0;
+    _previousX = _marioX;
+    _previousY = _marioY;
 }
 
 /**
@@ -179,19 +462,10 @@ void Jumpman::moveBackGround(int x, int y)
  */
 Entity Jumpman::printBackGround()
 {
-    int screenWidth = SCREEN_WIDTH;
-    int screenHeight = SCREEN_HEIGHT;
-    const int imageWidth = 3378;
-    const int imageHeight = 240;
-    double scaleX = static_cast<double>(screenWidth) / imageWidth;
-    double scaleY = static_cast<double>(screenHeight) / imageHeight;
-    double scale = std::max(scaleX, scaleY);
-    int newWidth = static_cast<int>(imageWidth * scale);
-    int newHeight = static_cast<int>(imageHeight * scale);
-    int offsetX = (screenWidth - newWidth) / 2 - static_cast<int>(_marioX);
-    int offsetY = (screenHeight - newHeight) / 2 - static_cast<int>(_marioY);
-    std::cout << "Scale: " << scale << "\nNew dimensions: " << newWidth << "x" << newHeight
-              << "\nOffsets: " << offsetX << ", " << offsetY << std::endl;
+    int newWidth = static_cast<int>(getLevelWidth());
+    int newHeight = static_cast<int>(_tiles.getRows() * _tiles.getTileSize() *
+        _worldScale);
+    int offsetX = -static_cast<int>(getCameraX());
     Entity background = createEntity(
         Shape::RECTANGLE,
         0, 0, newWidth, newHeight,
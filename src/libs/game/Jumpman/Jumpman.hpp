@@ -12,13 +12,29 @@
 #include "../interfaces/IGame.hpp"  // Ensure your interfaces are accessible.
 #include <map>
 #include <string>
-#include <chrono>
+#include "TileMap.hpp"
 
 // Screen dimensions and library name definitions.
 #define SCREEN_WIDTH 1024
 #define SCREEN_HEIGHT 768
 #define LIBRARY_NAME "Jumpman"
 
+// Level image, scaled to the height of the screen, and its collision map.
+// The size of the level is read from the map, this one is the fallback.
+#define JUMPMAN_LEVEL_WIDTH 3376
+#define JUMPMAN_LEVEL_HEIGHT 240
+#define JUMPMAN_COLLISION_MAP "assets/jumpman/colition.bmp"
+// Side of a collision tile, in pixels of the collision map.
+#define JUMPMAN_TILE_SIZE 4
+// Top of the floor used when the collision map cannot be read, in pixels.
+#define JUMPMAN_FALLBACK_GROUND 208
+
+// Mario, in screen pixels and pixels per second.
+#define JUMPMAN_SIZE 50
+#define JUMPMAN_SPAWN_X 128
+#define JUMPMAN_JUMP_SPEED 720
+#define JUMPMAN_MAX_FALL_SPEED 900
+
 class Jumpman : public IGame {
 public:
     Jumpman();
@@ -29,10 +45,14 @@ public:
     bool isGameEnd(void) override;
     std::string getNewLib(void) override;
     void handleEvent(std::vector<RawEvent>) override;
+    void update(double dt) override;
+    void fixedUpdate(double dt) override;
+    void setInterpolation(double alpha) override;
     std::map<std::string, Entity> renderGame() override;
     std::string getNewDisplay(void) override;
     std::string getName(void) override;
     void setUsername(std::string username) final;
+    void setSeed(std::uint64_t seed) final;
 
 protected:
     // Helpers for background and entity creation.
@@ -43,7 +63,13 @@ protected:
     void setCellColor(Entity &cell, int r, int g, int b);
 
     // Movement and collision detection.
-    void updateMovement();
+    void updateMovement(float deltaTime);
+    bool moveHorizontally(float dx);
+    bool moveVertically(float dy);
+    void spawn(void);
+    std::pair<float, float> getDrawnPosition(void) const;
+    float getLevelWidth(void) const;
+    float getCameraX(void) const;
     bool collisionAt(float newX, float newY);
     bool checkCollision(float x, float y, const Entity &block);
 
@@ -57,9 +83,18 @@ private:
     float _marioVelocityX;
     float _marioVelocityY;
     const float _marioSpeed;
-    std::chrono::steady_clock::time_point _lastUpdateTime;
+    // Position before the last step, drawn toward the current one
+    float _previousX;
+    float _previousY;
+    float _interpolation = 0;
+
+    // Solid tiles of the level, read once from the collision BMP, and
+    // the screen pixels per pixel of the map.
+    TileMap _tiles;
+    float _worldScale = 1;
 
-    // Collision blocks generated from the collision BMP.
+    // Solid blocks moving over the level, in screen pixels. There are
+    // none yet.
     std::vector<Entity> _collisionBlocks;
 };
 
@@ -0,0 +1,169 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** TileMap
+*/
+
+#include "TileMap.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <vector>
+
+static std::uint32_t readLittleEndian(const std::vector<unsigned char> &data,
+    std::size_t offset, int size)
+{
+    std::uint32_t value = 0;
+
+    for (int i = size - 1; i >= 0; i--)
+        value = value << 8 | data[offset + i];
+    return value;
+}
+
+/**
+ * @brief Build the map from an uncompressed 24 or 32-bit BMP
+ *
+ * With an alpha mask, the opaque pixels are solid; without one, the
+ * pixels that are not black are. The image is only read here, the map
+ * keeps a bit per tile.
+ *
+ * @param path The path of the image
+ * @param tileSize The side of a tile, in pixels
+ * @return true on success, false if the file is missing or not supported
+ */
+bool TileMap::loadBmp(const std::string &path, int tileSize)
+{
+    std::ifstream file(path, std::ios::binary);
+
+    if (!file.is_open()) {
+        std::cerr << "Unable to open collision map: " << path << std::endl;
+        return false;
+    }
+    std::vector<unsigned char> data((std::istreambuf_iterator<char>(file)),
+        std::istreambuf_iterator<char>());
+    // 54 bytes of headers, 16 more for the masks of BI_BITFIELDS
+    if (data.size() < 70 || data[0] != 'B' || data[1] != 'M') {
+        std::cerr << "Invalid collision map: " << path << std::endl;
+        return false;
+    }
+    std::uint32_t pixelOffset = readLittleEndian(data, 10, 4);
+    std::uint32_t headerSize = readLittleEndian(data, 14, 4);
+    int width = static_cast<std::int32_t>(readLittleEndian(data, 18, 4));
+    int height = static_cast<std::int32_t>(readLittleEndian(data, 22, 4));
+    int bitsPerPixel = readLittleEndian(data, 28, 2);
+    std::uint32_t compression = readLittleEndian(data, 30, 4);
+    bool isBottomUp = height > 0;
+    std::uint32_t colorMask = 0xFFFFFF;
+
+    height = std::abs(height);
+    // BI_BITFIELDS gives the masks, the alpha one in the V3+ headers only
+    if (compression == 3 && headerSize >= 56 && readLittleEndian(data, 66, 4))
+        colorMask = readLittleEndian(data, 66, 4);
+    else if (compression == 3)
+        colorMask = readLittleEndian(data, 54, 4) |
+            readLittleEndian(data, 58, 4) | readLittleEndian(data, 62, 4);
+    std::size_t stride = (static_cast<std::size_t>(width) * bitsPerPixel / 8
+        + 3) & ~std::size_t(3);
+    if (width <= 0 || height == 0 || tileSize <= 0 ||
+        (bitsPerPixel != 24 && bitsPerPixel != 32) ||
+        (compression != 0 && compression != 3) ||
+        pixelOffset + stride * height > data.size()) {
+        std::cerr << "Invalid collision map: " << path << std::endl;
+        return false;
+    }
+    reset((width + tileSize - 1) / tileSize, (height + tileSize - 1) / tileSize,
+        tileSize);
+    std::vector<int> solidPixels(getColumns() * getRows(), 0);
+    for (int y = 0; y < height; y++) {
+        std::size_t row = pixelOffset + stride * (isBottomUp ? height - 1 - y : y);
+        for (int x = 0; x < width; x++) {
+            std::uint32_t pixel = readLittleEndian(data,
+                row + x * bitsPerPixel / 8, bitsPerPixel / 8);
+            if (pixel & colorMask)
+                solidPixels[_solid.index(x / tileSize, y / tileSize)]++;
+        }
+    }
+    for (int row = 0; row < getRows(); row++) {
+        for (int column = 0; column < getColumns(); column++) {
+            int tileWidth = std::min(tileSize, width - column * tileSize);
+            int tileHeight = std::min(tileSize, height - row * tileSize);
+            setSolid(column, row, solidPixels[_solid.index(column, row)] * 2
+                >= tileWidth * tileHeight);
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Resize the map and make every tile empty
+ *
+ * @param columns The number of columns
+ * @param rows The number of rows
+ * @param tileSize The side of a tile, in pixels
+ */
+void TileMap::reset(int columns, int rows, int tileSize)
+{
+    _solid.reset(columns, rows);
+    _tileSize = tileSize;
+}
+
+void TileMap::setSolid(int column, int row, bool value)
+{
+    _solid.set(column, row, value);
+}
+
+/**
+ * @brief Check a tile, the tiles out of the map follow the borders
+ *
+ * @param column The column of the tile
+ * @param row The row of the tile
+ * @return true if the tile is solid
+ */
+bool TileMap::isSolid(int column, int row) const
+{
+    if (column < 0 || column >= getColumns())
+        return true;
+    if (row < 0 || row >= getRows())
+        return false;
+    return _solid.test(column, row);
+}
+
+/**
+ * @brief Check if a solid tile lies in a rectangle of tiles
+ *
+ * @param column0 The first column
+ * @param row0 The first row
+ * @param column1 The last column, included
+ * @param row1 The last row, included
+ * @return true if any tile of the rectangle is solid
+ */
+bool TileMap::isAreaSolid(int column0, int row0, int column1, int row1) const
+{
+    for (int row = row0; row <= row1; row++) {
+        for (int column = column0; column <= column1; column++) {
+            if (isSolid(column, row))
+                return true;
+        }
+    }
+    return false;
+}
+
+int TileMap::getColumns(void) const
+{
+    return _solid.getWidth();
+}
+
+int TileMap::getRows(void) const
+{
+    return _solid.getHeight();
+}
+
+int TileMap::getTileSize(void) const
+{
+    return _tileSize;
+}
@@ -0,0 +1,45 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** TileMap
+*/
+
+#ifndef TILEMAP_HPP_
+    #define TILEMAP_HPP_
+
+    #include <string>
+
+    #include "../utils/BitGrid.hpp"
+
+/**
+ * @brief Solid tiles of a level, one bit per tile
+ *
+ * The map is built once from a collision image: a tile of tileSize x
+ * tileSize pixels is solid when at least half of its pixels are. Testing
+ * an area only reads the bits of the tiles it covers, whatever the size of
+ * the level. The columns left and right of the map are solid, so the
+ * player cannot leave the level sideways; the rows above and below are
+ * empty.
+ */
+class TileMap {
+    public:
+        TileMap() = default;
+
+        bool loadBmp(const std::string &path, int tileSize);
+        void reset(int columns, int rows, int tileSize);
+
+        void setSolid(int column, int row, bool value = true);
+        bool isSolid(int column, int row) const;
+        bool isAreaSolid(int column0, int row0, int column1, int row1) const;
+
+        int getColumns(void) const;
+        int getRows(void) const;
+        int getTileSize(void) const;
+
+    private:
+        BitGrid _solid;
+        int _tileSize = 1;
+};
+
+#endif /* !TILEMAP_HPP_ */
@@ -136,6 +136,16 @@ void Menu::setUsername(std::string username)
     _username = username;
 }
 
+/**
+ * @brief Set the seed of the random generator
+ *
+ * @param seed The seed to use
+ */
+void Menu::setSeed(std::uint64_t seed)
+{
+    _random.setSeed(seed);
+}
+
 ////////////////////////////// Event Handling ///////////////////////////////
 
 //-------------------------------- Game Lib --------------------------------//
@@ -162,7 +172,6 @@ void Menu::checkGameClick(RawEvent event)
                 _sounds.push_back(std::string(ASSETS_DIR) + "click2.ogg");
             }
             _selectedGameLib = i;
-            _reloadScoreboard = true;
             return;
         }
     }
@@ -302,7 +311,7 @@ void Menu::checkUsernameInputKeyboard(RawEvent event)
                              (static_cast<int>(event.key) -
                                  static_cast<int>(EventKey::KEYBOARD_A));
             _username += character;
-            int randomNum = rand() % 3 + 1;
+            int randomNum = _random.range(1, 3);
             _sounds.push_back(std::string(ASSETS_DIR) + "keyboard-click" +
                               std::to_string(randomNum) + ".ogg");
         }
@@ -388,6 +397,38 @@ void Menu::handleOneEvent(RawEvent event)
     checkControlKey(event);
 }
 
+/**
+ * @brief Advance the time of the menu
+ *
+ * The menu animates per frame and has no timer, so the time is unused.
+ *
+ * @param dt The time elapsed since the previous frame, in seconds
+ */
+void Menu::update(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The menu has no simulation to step
+ *
+ * @param dt The duration of the step, in seconds
+ */
+void Menu::fixedUpdate(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The menu has no motion to interpolate
+ *
+ * @param alpha The share of a step since the last one
+ */
+void Menu::setInterpolation(double alpha)
+{
+    (void) alpha;
+}
+
 /**
  * @brief Handle events
  *
@@ -784,9 +825,8 @@ void Menu::renderUsernameInput(std::map<EntityName, Entity> &entities)
     else
         setEntityColor(startText, 180, 180, 180);
     if (_typingUsername) {
-        static int blinkCount = 0;
-        blinkCount = (blinkCount + 1) % 60;
-        if (blinkCount < 30) {
+        _blinkCount = (_blinkCount + 1) % 60;
+        if (_blinkCount < 30) {
             username += "|";
         }
     }
@@ -800,38 +840,28 @@ void Menu::renderUsernameInput(std::map<EntityName, Entity> &entities)
 //------------------------------- Scoreboard -------------------------------//
 
 /**
- * @brief Get the content of the scoreboard
- *
- * This function retrieves the scores from the ScoreManager and
- * formats them into a string for display.
+ * @brief Update the cached scoreboard content
  *
- * @return std::string The formatted scoreboard content
+ * The rows come preformatted from the shared Leaderboard. The content
+ * entities are only rebuilt when the selected game or the version of
+ * its board changes.
  */
-std::vector<std::string> Menu::getScoreboardContent(void)
+void Menu::updateScoreboardContent(void)
 {
-    ScoreManager scoreManager;
+    Leaderboard &leaderboard = Leaderboard::getInstance();
     std::string gameName = _gameLibs[_selectedGameLib].first.name;
-    std::string fileName = "score/score_" + gameName + ".txt";
-    std::vector<std::pair<float, std::string>> scores =
-        scoreManager.loadScoresFromFile(fileName);
+    std::size_t version = leaderboard.getVersion(gameName);
 
+    if (gameName == _scoreboardGame && version == _scoreboardVersion)
+        return;
+    _scoreboardGame = gameName;
+    _scoreboardVersion = version;
     _scoreboardContent.clear();
-    for (size_t i = 0; i < scores.size() && i < 20; i++) {
-        _scoreboardContent.push_back(
-            scores[i].second + ": " +
-            std::to_string(static_cast<int>(scores[i].first)));
-    }
-
-    if (_scoreboardContent.empty()) {
-        _scoreboardContent.push_back("No scores available");
-    }
-
-    _reloadScoreboard = false;
-    return _scoreboardContent;
+    renderScoreboardContent(_scoreboardContent, leaderboard.getRows(gameName));
 }
 
-void Menu::renderScoreboardContent(
-    std::map<EntityName, Entity> &entities, std::vector<std::string> content)
+void Menu::renderScoreboardContent(std::map<EntityName, Entity> &entities,
+    const std::vector<std::string> &content)
 {
     Entity scoreboardContent;
     size_t y = 0;
@@ -863,8 +893,6 @@ void Menu::renderScoreboardContent(
 void Menu::renderScoreboard(std::map<EntityName, Entity> &entities)
 {
     Entity scoreboardTitle;
-    std::vector<std::string> content =
-        _reloadScoreboard ? getScoreboardContent() : _scoreboardContent;
     Entity scoreboardFrame = createEntity(Shape::RECTANGLE, 0, 0, 629 / 2.4,
         1380 / 2.4, SCOREBOARD_TITLE_X - 20, SCOREBOARD_TITLE_Y - 21,
         {{DisplayType::TERMINAL, ""},
@@ -883,7 +911,8 @@ void Menu::renderScoreboard(std::map<EntityName, Entity> &entities)
     entities["C-scoreboardTitle"] = scoreboardTitle;
     setEntityColor(scoreboardFrame, 0, 0, 0);
     entities["B-scoreboardMenu"] = scoreboardFrame;
-    renderScoreboardContent(entities, content);
+    updateScoreboardContent();
+    entities.insert(_scoreboardContent.begin(), _scoreboardContent.end());
 }
 
 //--------------------------------- Sounds ---------------------------------//
@@ -14,9 +14,11 @@
     #include <cstdlib>
 
     #include "../../../core/LibGetter.hpp"
+    #include "../../../core/Leaderboard.hpp"
     #include "../../../core/ScoreManager.hpp"
     #include "../../../libs/display/interfaces/IDisplay.hpp"
     #include "../../../libs/game/interfaces/IGame.hpp"
+    #include "../utils/Random.hpp"
 
     #define LIBRARY_PATH "./lib/"
     #define SCREEN_WIDTH 1024
@@ -77,9 +79,13 @@ class Menu : public IGame {
         std::string getNewDisplay(void) final;
 
         void handleEvent(std::vector<RawEvent>) final;
+        void update(double dt) final;
+        void fixedUpdate(double dt) final;
+        void setInterpolation(double alpha) final;
 
         std::string getName(void) final;
         void setUsername(std::string username) final;
+        void setSeed(std::uint64_t seed) final;
 
         std::map<IGame::EntityName, Entity> renderGame() final;
 
@@ -117,9 +123,9 @@ class Menu : public IGame {
         void renderQuitButton(std::map<EntityName, Entity> &entities);
         void renderBackground(std::map<EntityName, Entity> &entities);
         void renderUsernameInput(std::map<EntityName, Entity> &entities);
-        std::vector<std::string> getScoreboardContent(void);
+        void updateScoreboardContent(void);
         void renderScoreboardContent(std::map<EntityName, Entity> &entities,
-            std::vector<std::string> content);
+            const std::vector<std::string> &content);
         void renderScoreboard(std::map<EntityName, Entity> &entities);
         void addSoundEntities(std::map<std::string, Entity> &entities);
 
@@ -139,12 +145,15 @@ class Menu : public IGame {
         bool _startGame;
         std::string _username = "Username";
         bool _typingUsername = false;
+        int _blinkCount = 0;
         bool _shiftPressed = false;
         bool _controlPressed = false;
-        std::vector<std::string> _scoreboardContent;
-        bool _reloadScoreboard = true;
+        std::map<EntityName, Entity> _scoreboardContent;
+        std::string _scoreboardGame;
+        std::size_t _scoreboardVersion = 0;
         std::vector<std::string> _sounds;
         bool _quit = false;
+        Random _random;
 };
 
 #endif /* !MENU_HPP_ */
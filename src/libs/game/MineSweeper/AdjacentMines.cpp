@@ -0,0 +1,189 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** AdjacentMines
+*/
+
+#include "AdjacentMines.hpp"
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define ADJACENT_MINES_X86
+#endif
+
+/**
+ * @brief Count the neighbours of the cells of a row from a column
+ *
+ * @param plane The padded mine plane
+ * @param width The width of the board
+ * @param y The row
+ * @param x The first column to count
+ * @param counts The counts of the whole board
+ */
+static void countRowScalar(const std::uint8_t *plane, int width, int y,
+    int x, std::uint8_t *counts)
+{
+    int stride = width + 2;
+    const std::uint8_t *above = plane + y * stride;
+    const std::uint8_t *middle = above + stride;
+    const std::uint8_t *below = middle + stride;
+
+    for (; x < width; x++) {
+        counts[y * width + x] = above[x] + above[x + 1] + above[x + 2] +
+            middle[x] + middle[x + 2] + below[x] + below[x + 1] +
+            below[x + 2];
+    }
+}
+
+/**
+ * @brief Count the neighbours of every cell, one cell at a time
+ *
+ * @param plane The padded mine plane
+ * @param width The width of the board
+ * @param height The height of the board
+ * @param counts The counts of the board
+ */
+void countAdjacentMinesScalar(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts)
+{
+    for (int y = 0; y < height; y++)
+        countRowScalar(plane, width, y, 0, counts);
+}
+
+#ifdef ADJACENT_MINES_X86
+
+/**
+ * @brief Count the neighbours of every cell, 16 cells at a time
+ *
+ * Each count is the sum of the three rows around the cell, loaded at the
+ * three columns around it, minus the cell itself. A sum is at most 9, so
+ * the bytes never overflow.
+ *
+ * @param plane The padded mine plane
+ * @param width The width of the board
+ * @param height The height of the board
+ * @param counts The counts of the board
+ */
+__attribute__((target("sse2")))
+void countAdjacentMinesSse2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts)
+{
+    int stride = width + 2;
+
+    for (int y = 0; y < height; y++) {
+        const std::uint8_t *row = plane + y * stride;
+        int x = 0;
+        for (; x + 16 <= width; x += 16) {
+            __m128i sum = _mm_setzero_si128();
+            for (int dy = 0; dy < 3; dy++) {
+                const std::uint8_t *cell = row + dy * stride + x;
+                sum = _mm_add_epi8(sum, _mm_loadu_si128((const __m128i *)cell));
+                sum = _mm_add_epi8(sum,
+                    _mm_loadu_si128((const __m128i *)(cell + 1)));
+                sum = _mm_add_epi8(sum,
+                    _mm_loadu_si128((const __m128i *)(cell + 2)));
+            }
+            sum = _mm_sub_epi8(sum,
+                _mm_loadu_si128((const __m128i *)(row + stride + x + 1)));
+            _mm_storeu_si128((__m128i *)(counts + y * width + x), sum);
+        }
+        countRowScalar(plane, width, y, x, counts);
+    }
+}
+
+/**
+ * @brief Count the neighbours of every cell, 32 cells at a time
+ *
+ * Same sums as the SSE2 version on 256-bit registers.
+ *
+ * @param plane The padded mine plane
+ * @param width The width of the board
+ * @param height The height of the board
+ * @param counts The counts of the board
+ */
+__attribute__((target("avx2")))
+void countAdjacentMinesAvx2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts)
+{
+    int stride = width + 2;
+
+    for (int y = 0; y < height; y++) {
+        const std::uint8_t *row = plane + y * stride;
+        int x = 0;
+        for (; x + 32 <= width; x += 32) {
+            __m256i sum = _mm256_setzero_si256();
+            for (int dy = 0; dy < 3; dy++) {
+                const std::uint8_t *cell = row + dy * stride + x;
+                sum = _mm256_add_epi8(sum,
+                    _mm256_loadu_si256((const __m256i *)cell));
+                sum = _mm256_add_epi8(sum,
+                    _mm256_loadu_si256((const __m256i *)(cell + 1)));
+                sum = _mm256_add_epi8(sum,
+                    _mm256_loadu_si256((const __m256i *)(cell + 2)));
+            }
+            sum = _mm256_sub_epi8(sum,
+                _mm256_loadu_si256((const __m256i *)(row + stride + x + 1)));
+            _mm256_storeu_si256((__m256i *)(counts + y * width + x), sum);
+        }
+        countRowScalar(plane, width, y, x, counts);
+    }
+}
+
+bool hasAdjacentMinesSse2(void)
+{
+    return __builtin_cpu_supports("sse2");
+}
+
+bool hasAdjacentMinesAvx2(void)
+{
+    return __builtin_cpu_supports("avx2");
+}
+
+#else
+
+void countAdjacentMinesSse2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts)
+{
+    countAdjacentMinesScalar(plane, width, height, counts);
+}
+
+void countAdjacentMinesAvx2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts)
+{
+    countAdjacentMinesScalar(plane, width, height, counts);
+}
+
+bool hasAdjacentMinesSse2(void)
+{
+    return false;
+}
+
+bool hasAdjacentMinesAvx2(void)
+{
+    return false;
+}
+
+#endif
+
+/**
+ * @brief Count the neighbours of every cell with the fastest implementation
+ *
+ * The implementation is chosen once from the features of the CPU, the
+ * scalar one is used on other architectures.
+ *
+ * @param plane The padded mine plane
+ * @param width The width of the board
+ * @param height The height of the board
+ * @param counts The counts of the board
+ */
+void countAdjacentMines(const std::uint8_t *plane, int width, int height,
+    std::uint8_t *counts)
+{
+    static const AdjacentMinesFunction count =
+        hasAdjacentMinesAvx2() ? countAdjacentMinesAvx2 :
+        hasAdjacentMinesSse2() ? countAdjacentMinesSse2 :
+        countAdjacentMinesScalar;
+
+    count(plane, width, height, counts);
+}
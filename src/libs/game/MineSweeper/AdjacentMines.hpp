@@ -0,0 +1,40 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** AdjacentMines
+*/
+
+#ifndef ADJACENTMINES_HPP_
+    #define ADJACENTMINES_HPP_
+
+    #include <cstdint>
+
+/*
+ * The mines are given as a padded byte plane of (width + 2) * (height + 2)
+ * bytes, row-major: 1 for a mine, 0 otherwise, with a border of zeros
+ * around the board. The counts are written to width * height bytes,
+ * row-major, without padding. A mine cell gets the count of its neighbours
+ * like any other cell.
+ */
+
+/**
+ * @brief An implementation of the neighbour count
+ */
+using AdjacentMinesFunction = void (*)(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts);
+
+void countAdjacentMinesScalar(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts);
+void countAdjacentMinesSse2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts);
+void countAdjacentMinesAvx2(const std::uint8_t *plane, int width,
+    int height, std::uint8_t *counts);
+
+bool hasAdjacentMinesSse2(void);
+bool hasAdjacentMinesAvx2(void);
+
+void countAdjacentMines(const std::uint8_t *plane, int width, int height,
+    std::uint8_t *counts);
+
+#endif /* !ADJACENTMINES_HPP_ */
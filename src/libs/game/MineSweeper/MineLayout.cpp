@@ -0,0 +1,183 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** MineLayout
+*/
+
+#include "MineLayout.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+#include "AdjacentMines.hpp"
+
+enum SolverCell : std::uint8_t {
+    SOLVER_HIDDEN,
+    SOLVER_REVEALED,
+    SOLVER_FLAGGED
+};
+
+/**
+ * @brief Place mines uniformly, away from the first click
+ *
+ * The cells outside the 3x3 square around the first click are listed once,
+ * then a partial Fisher-Yates shuffle draws the mines among them. The time
+ * is linear in the number of cells whatever the density, unlike drawing
+ * random cells until enough of them are free.
+ *
+ * @param mines The cleared plane to put the mines in
+ * @param firstX The column of the first click
+ * @param firstY The row of the first click
+ * @param count The number of mines, capped to the number of free cells
+ * @param random The generator to draw from
+ */
+void placeMinesUniform(BitGrid &mines, int firstX, int firstY, int count,
+    Random &random)
+{
+    std::vector<int> cells;
+
+    cells.reserve(mines.getWidth() * mines.getHeight());
+    for (int y = 0; y < mines.getHeight(); y++) {
+        for (int x = 0; x < mines.getWidth(); x++) {
+            if (std::abs(x - firstX) <= 1 && std::abs(y - firstY) <= 1)
+                continue;
+            cells.push_back(mines.index(x, y));
+        }
+    }
+    count = std::min<int>(count, cells.size());
+    for (int i = 0; i < count; i++) {
+        int j = i + random.below(cells.size() - i);
+        std::swap(cells[i], cells[j]);
+        mines.set(cells[i]);
+    }
+}
+
+/**
+ * @brief Check if a layout can be cleared without guessing
+ *
+ * Plays the board from the first click with the two rules a player can
+ * apply to a single number: all its mines are flagged, so its other
+ * neighbours are safe, or its hidden neighbours are all mines. The layout
+ * is accepted when these rules alone reveal every safe cell.
+ *
+ * @param mines The mines of the layout
+ * @param firstX The column of the first click
+ * @param firstY The row of the first click
+ * @return true if no guess is needed
+ */
+bool isSolvableWithoutGuess(const BitGrid &mines, int firstX, int firstY)
+{
+    int width = mines.getWidth();
+    int height = mines.getHeight();
+    int stride = width + 2;
+    std::vector<std::uint8_t> plane(stride * (height + 2), 0);
+    std::vector<std::uint8_t> counts(width * height);
+    std::vector<std::uint8_t> state(width * height, SOLVER_HIDDEN);
+    std::vector<int> stack;
+    int safe = width * height - mines.count();
+    int revealed = 0;
+    bool progress = true;
+
+    for (int i = 0; i < width * height; i++) {
+        if (mines.test(i))
+            plane[(i / width + 1) * stride + i % width + 1] = 1;
+    }
+    countAdjacentMines(plane.data(), width, height, counts.data());
+    auto reveal = [&](int start) {
+        state[start] = SOLVER_REVEALED;
+        revealed++;
+        stack.push_back(start);
+        while (!stack.empty()) {
+            int index = stack.back();
+            int x = index % width;
+            int y = index / width;
+            stack.pop_back();
+            if (counts[index] > 0)
+                continue;
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ny++) {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); nx++) {
+                    int neighbour = mines.index(nx, ny);
+                    if (state[neighbour] != SOLVER_HIDDEN)
+                        continue;
+                    state[neighbour] = SOLVER_REVEALED;
+                    revealed++;
+                    stack.push_back(neighbour);
+                }
+            }
+        }
+    };
+    reveal(mines.index(firstX, firstY));
+    while (progress && revealed < safe) {
+        progress = false;
+        for (int index = 0; index < width * height; index++) {
+            if (state[index] != SOLVER_REVEALED || counts[index] == 0)
+                continue;
+            int x = index % width;
+            int y = index / width;
+            int hidden = 0;
+            int flagged = 0;
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ny++) {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); nx++) {
+                    hidden += state[mines.index(nx, ny)] == SOLVER_HIDDEN;
+                    flagged += state[mines.index(nx, ny)] == SOLVER_FLAGGED;
+                }
+            }
+            if (hidden == 0 || (flagged != counts[index] &&
+                flagged + hidden != counts[index]))
+                continue;
+            for (int ny = std::max(y - 1, 0); ny <= std::min(y + 1, height - 1); ny++) {
+                for (int nx = std::max(x - 1, 0); nx <= std::min(x + 1, width - 1); nx++) {
+                    int neighbour = mines.index(nx, ny);
+                    if (state[neighbour] != SOLVER_HIDDEN)
+                        continue;
+                    if (flagged == counts[index])
+                        reveal(neighbour);
+                    else
+                        state[neighbour] = SOLVER_FLAGGED;
+                }
+            }
+            progress = true;
+        }
+    }
+    return revealed == safe;
+}
+
+/**
+ * @brief Generate a layout that can be cleared without guessing
+ *
+ * Uniform layouts are drawn until one passes isSolvableWithoutGuess, at
+ * most MINESWEEPER_NO_GUESS_ATTEMPTS times; if none does, the last one is
+ * kept and a warning is printed, so the search always ends on dense
+ * boards. Meant to run on a worker thread, it only reads its arguments.
+ *
+ * @param width The width of the board
+ * @param height The height of the board
+ * @param count The number of mines
+ * @param firstX The column of the first click
+ * @param firstY The row of the first click
+ * @param seed The seed of the layouts
+ * @param cancel Set by the game to stop early, may be nullptr
+ * @return BitGrid The mines of the layout
+ */
+BitGrid generateNoGuessLayout(int width, int height, int count, int firstX,
+    int firstY, std::uint64_t seed, const std::atomic<bool> *cancel)
+{
+    Random random(seed);
+    BitGrid mines(width, height);
+
+    for (int attempt = 0; attempt < MINESWEEPER_NO_GUESS_ATTEMPTS; attempt++) {
+        if (cancel && cancel->load(std::memory_order_relaxed))
+            return mines;
+        mines.clear();
+        placeMinesUniform(mines, firstX, firstY, count, random);
+        if (isSolvableWithoutGuess(mines, firstX, firstY))
+            return mines;
+    }
+    std::cerr << "No board without guess found in "
+              << MINESWEEPER_NO_GUESS_ATTEMPTS << " attempts, dealing one "
+              << "that may need a guess" << std::endl;
+    return mines;
+}
@@ -0,0 +1,25 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** MineLayout
+*/
+
+#ifndef MINELAYOUT_HPP_
+    #define MINELAYOUT_HPP_
+
+    #include <atomic>
+    #include <cstdint>
+
+    #include "../utils/BitGrid.hpp"
+    #include "../utils/Random.hpp"
+
+    #define MINESWEEPER_NO_GUESS_ATTEMPTS 500
+
+void placeMinesUniform(BitGrid &mines, int firstX, int firstY, int count,
+    Random &random);
+bool isSolvableWithoutGuess(const BitGrid &mines, int firstX, int firstY);
+BitGrid generateNoGuessLayout(int width, int height, int count, int firstX,
+    int firstY, std::uint64_t seed, const std::atomic<bool> *cancel);
+
+#endif /* !MINELAYOUT_HPP_ */
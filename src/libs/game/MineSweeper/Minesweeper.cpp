@@ -6,9 +6,12 @@
 */
 
 #include "Minesweeper.hpp"
+#include "AdjacentMines.hpp"
+#include "MineLayout.hpp"
 #include <iostream>
 #include <chrono>
 #include <cstdlib>
+#include <cstdio>
 #include <cmath>
 
 /**
@@ -29,6 +32,10 @@ Minesweeper::Minesweeper()
     // (Assuming MEDIUM is defined; here we use 40 mines and a board size of 16x16.)
     _dificulty.difficulty = MEDIUM;
     select_dificulty(40, 16, 16);
+    loadBoardFromEnv();
+    const char *noGuess = std::getenv(MINESWEEPER_NO_GUESS_ENV);
+    _isNoGuess = noGuess && std::string(noGuess) != "0";
+    loadAssetPacks();
 
     // Ensure timer state is reset
     _timerPaused = false;
@@ -40,6 +47,7 @@ Minesweeper::Minesweeper()
  */
 Minesweeper::~Minesweeper()
 {
+    cancelLayoutJob();
 }
 
 /**
@@ -97,6 +105,36 @@ std::string Minesweeper::getNewDisplay(void)
     return "";
 }
 
+/**
+ * @brief Advances the clock the game timer is read from.
+ *
+ * @param dt The time elapsed since the previous frame, in seconds.
+ */
+void Minesweeper::update(double dt)
+{
+    _clock.advance(dt);
+}
+
+/**
+ * @brief The board only changes on clicks, there is nothing to step.
+ *
+ * @param dt The duration of the step, in seconds.
+ */
+void Minesweeper::fixedUpdate(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The board has no motion to interpolate.
+ *
+ * @param alpha The share of a step since the last one.
+ */
+void Minesweeper::setInterpolation(double alpha)
+{
+    (void) alpha;
+}
+
 /**
  * @brief Handles input events by delegating to appropriate event handlers.
  *
@@ -115,16 +153,35 @@ void Minesweeper::handleEvent(std::vector<RawEvent> events)
     }
 }
 
+/**
+ * @brief Loads the cell manifest of every asset pack.
+ *
+ * The manifests are read once here, a cell is then drawn by looking its
+ * kind up in the current pack. A pack whose manifest fails to load is
+ * reported and keeps blank cells.
+ */
+void Minesweeper::loadAssetPacks()
+{
+    const std::vector<std::string> kinds = MINESWEEPER_SPRITE_KINDS;
+
+    _assetPacks.assign(_assetPackDirs.size(), SpriteManifest(CELL_COUNT));
+    for (std::size_t i = 0; i < _assetPackDirs.size(); i++) {
+        if (!_assetPacks[i].load(_assetPackDirs[i] +
+            MINESWEEPER_CELLS_MANIFEST, kinds))
+            _assetPacks[i] = SpriteManifest(CELL_COUNT);
+    }
+}
+
 /**
  * @brief Sets the sprite path based on the selected asset pack.
  */
 void Minesweeper::setSprite()
 {
-    if (_assetPack == 0) {
-        _Sprite = "assets/Minesweeper_1/";
-    } else if (_assetPack == 1) {
-        _Sprite = "assets/M_2/";
-    }
+    std::string previous = _Sprite;
+
+    _Sprite = _assetPackDirs[_assetPack];
+    if (_Sprite != previous)
+        _isBoardDirty = true;
 }
 
 /**
@@ -134,6 +191,7 @@ void Minesweeper::setSprite()
  */
 void Minesweeper::handleEventGame(std::vector<RawEvent> events)
 {
+    updateLayoutJob();
     updateSmileyState();
     if (events.empty())
         return;
@@ -156,18 +214,11 @@ void Minesweeper::handleEventGame(std::vector<RawEvent> events)
                 handleRightClick(event);
             }
             if (event.key == EventKey::KEYBOARD_F1) {
-                if (_assetPack == 1) {
-                    _assetPack = 0;
-                } else {
-                    _assetPack += 1;
-                }
+                _assetPack = (_assetPack + 1) % _assetPackDirs.size();
             }
             if (event.key == EventKey::KEYBOARD_F2) {
-                if (_assetPack == 0) {
-                    _assetPack = 1;
-                } else {
-                    _assetPack -= 1;
-                }
+                _assetPack = (_assetPack + _assetPackDirs.size() - 1) %
+                    _assetPackDirs.size();
             }
         }
         setSprite();
@@ -180,12 +231,10 @@ void Minesweeper::handleEventGame(std::vector<RawEvent> events)
  */
 void Minesweeper::updateSmileyState()
 {
-    static int loop = 0;
-
     if (_smileyState == CLICK) {
-        loop++;
-        if (loop >= 15) {
-            loop = 0;
+        _smileyFrames++;
+        if (_smileyFrames >= 15) {
+            _smileyFrames = 0;
             _smileyState = SMILEY;
         }
     }
@@ -222,11 +271,11 @@ void Minesweeper::handleRightClick(const RawEvent &event)
  */
 void Minesweeper::checkTimeLimit()
 {
-    auto currentTime = std::chrono::steady_clock::now();
+    auto currentTime = _clock.now();
     std::chrono::duration<float> elapsed = currentTime - _startTime;
     if (elapsed.count() >= _timeLimit) {
         revealBombs();
-        _score.first += countFlaggedMines() * 200;
+        _score.first += _flaggedMines * 200;
         _state = GAME_LOSE;
     }
 }
@@ -270,6 +319,32 @@ void Minesweeper::select_dificulty(int mines, int width, int height)
     _dificulty.size_y = height;
 }
 
+/**
+ * @brief Replaces the default board by the one given in the environment.
+ *
+ * ARCADE_MINESWEEPER_BOARD holds "<width>x<height>x<mines>", it is used by
+ * the benchmarks to play on boards the menu does not offer.
+ */
+void Minesweeper::loadBoardFromEnv(void)
+{
+    const char *board = std::getenv(MINESWEEPER_BOARD_ENV);
+    int width = 0;
+    int height = 0;
+    int mines = 0;
+
+    if (!board)
+        return;
+    if (std::sscanf(board, "%dx%dx%d", &width, &height, &mines) != 3 ||
+        width < 4 || height < 4 || width > MINESWEEPER_MAX_SIZE ||
+        height > MINESWEEPER_MAX_SIZE || mines < 1 ||
+        mines > width * height - 9) {
+        std::cerr << "Invalid " << MINESWEEPER_BOARD_ENV << ": " << board
+                  << std::endl;
+        return;
+    }
+    select_dificulty(mines, width, height);
+}
+
 /**
  * @brief Handles events from the menu.
  *
@@ -344,12 +419,10 @@ void Minesweeper::handleEventMenu(std::vector<RawEvent> events)
  */
 void Minesweeper::handleNameInput(std::vector<RawEvent> events)
 {
-    static bool isShiftActive = false;
-
     for (const auto &event : events) {
         if (event.type == EventType::PRESS) {
             if (event.key == EventKey::KEYBOARD_LSHIFT || event.key == EventKey::KEYBOARD_RSHIFT) {
-                isShiftActive = true;
+                _isShiftActive = true;
             }
             if (event.key == EventKey::KEYBOARD_BACKSPACE && !_playerName.empty()) {
                 _playerName.pop_back();
@@ -363,19 +436,19 @@ void Minesweeper::handleNameInput(std::vector<RawEvent> events)
             if (event.key >= EventKey::KEYBOARD_A && event.key <= EventKey::KEYBOARD_Z) {
                 if (_playerName.length() < 8) {
                     char character;
-                    if (isShiftActive) {
+                    if (_isShiftActive) {
                         character = 'A' + (event.key - EventKey::KEYBOARD_A);
                     } else {
                         character = 'a' + (event.key - EventKey::KEYBOARD_A);
                     }
                     _playerName += character;
-                    int randomNum = rand() % 3 + 1;
+                    int randomNum = _random.range(1, 3);
                     _sounds.push_back("assets/menu/keyboard-click" + std::to_string(randomNum) + ".ogg");
                 }
             }
         }
         else if (event.type == EventType::RELEASE && (event.key == EventKey::KEYBOARD_LSHIFT || event.key == EventKey::KEYBOARD_RSHIFT)) {
-            isShiftActive = false;
+            _isShiftActive = false;
         }
     }
 }
@@ -579,9 +652,8 @@ void Minesweeper::addNameInputEntity(std::map<std::string, Entity> &entities)
     // Input text with cursor
     std::string displayName = _playerName;
     if (_isNameInputActive) {
-        static int blinkCount = 0;
-        blinkCount = (blinkCount + 1) % 60;
-        if (blinkCount < 30) {
+        _blinkCount = (_blinkCount + 1) % 60;
+        if (_blinkCount < 30) {
             displayName += "|";
         }
     }
@@ -702,56 +774,32 @@ Entity Minesweeper::createBackgroundEntity(const std::string &spritePath)
  */
 std::map<std::string, Entity> Minesweeper::printBoard()
 {
-    std::map<std::string, Entity> entities;
-    addCellEntities(entities);
+    updateBoardEntities();
+    std::map<std::string, Entity> entities = _boardEntities;
     addGameUIElements(entities);
 
     if (_isEesterEgg == true) {
-        static int loop = 0;
-        loop++;
-        if (loop >= 360) {
-            loop = 0;
+        _easterEggAngle++;
+        if (_easterEggAngle >= 360) {
+            _easterEggAngle = 0;
         }
         for (auto &entity : entities) {
-            entities[entity.first].rotate = loop;
+            entities[entity.first].rotate = _easterEggAngle;
         }
     }
     return entities;
 }
 
-void Minesweeper::setCellColor(Entity &entity, int x, int y)
-{
-    if (_board[y][x].isRevealed) {
-        if (_board[y][x].isMine && _board[y][x].State == LOSER) {
-            setCellColor(entity, 255, 0, 0);
-        } else if (_board[y][x].isMine) {
-            setCellColor(entity, 255, 0, 0);
-        } else if (_board[y][x].adjacentMines == 1) {
-            setCellColor(entity, 0, 255, 0);
-        } else if (_board[y][x].adjacentMines == 2) {
-            setCellColor(entity, 0, 0, 255);
-        } else if (_board[y][x].adjacentMines == 3) {
-            setCellColor(entity, 255, 255, 0);
-        } else if (_board[y][x].adjacentMines == 4) {
-            setCellColor(entity, 255, 0, 255);
-        } else if (_board[y][x].adjacentMines == 5) {
-            setCellColor(entity, 0, 255, 255);
-        } else if (_board[y][x].adjacentMines == 6) {
-            setCellColor(entity, 255, 255, 255);
-        } else if (_board[y][x].adjacentMines == 7) {
-            setCellColor(entity, 255, 0, 0);
-        } else if (_board[y][x].adjacentMines == 8) {
-            setCellColor(entity, 0, 0, 0);
-        } else {
-            setCellColor(entity, 200, 200, 200);
-        }
-    } else if (_board[y][x].State == FLAGGED) {
-        setCellColor(entity, 255, 0, 0);
-    } else if (_board[y][x].State == QMARK) {
-        setCellColor(entity, 0, 0, 255);
-    } else {
-        setCellColor(entity, 255, 255, 255);
-    }
+/**
+ * @brief Draws a cell with the sprite of its kind in the current pack.
+ *
+ * @param entity The entity of the cell.
+ * @param x Cell X coordinate.
+ * @param y Cell Y coordinate.
+ */
+void Minesweeper::applyCellSprite(Entity &entity, int x, int y)
+{
+    _assetPacks[_assetPack][getCellSprite(x, y)].apply(entity);
 }
 
 /**
@@ -768,70 +816,118 @@ void Minesweeper::addCellEntities(std::map<std::string, Entity> &entities)
 
     for (int y = 0; y < _height; y++) {
         for (int x = 0; x < _width; x++) {
-            std::map<DisplayType, std::string> sprite = getCellSprite(x, y);
             Entity cell = createEntity(
                 Shape::RECTANGLE, x, y, cellWidth, cellHeight,
-                offsetX, offsetY,
-                sprite
+                offsetX, offsetY, {}
             );
-            setCellColor(cell, x, y);
+            applyCellSprite(cell, x, y);
             entities["cell_" + std::to_string(x) + "_" + std::to_string(y)] = cell;
         }
     }
-    for (int y = 0; y < SCREEN_HEIGHT / cellHeight; y++) {
-        for (int x = 0; x < SCREEN_WIDTH / cellWidth; x++) {
-            if (x >= _width || y >= _height) {
-                Entity emptyCell = createEntity(
-                    Shape::RECTANGLE, x, y, cellWidth, cellHeight,
-                    offsetX, offsetY,
-                    {
-                        {DisplayType::TERMINAL, " "},
-                        {DisplayType::GRAPHICAL, ""}
-                    }
-                );
-                setCellColor(emptyCell, 0, 0, 0);
-                entities["empty_" + std::to_string(x) + "_" + std::to_string(y)] = emptyCell;
+    addPaddingEntity(entities, "empty_right", offsetX + _width * cellWidth, 0,
+        SCREEN_WIDTH - (offsetX + _width * cellWidth), SCREEN_HEIGHT);
+    addPaddingEntity(entities, "empty_bottom", offsetX,
+        offsetY + _height * cellHeight, SCREEN_WIDTH - offsetX,
+        SCREEN_HEIGHT - (offsetY + _height * cellHeight));
+}
+
+/**
+ * @brief Adds a black rectangle covering the screen next to the board.
+ *
+ * One rectangle per side, instead of one entity per screen cell, so that
+ * the padding costs the same whatever the size of the board.
+ *
+ * @param entities The map to add the entity to.
+ * @param name The name of the entity.
+ * @param x The x-coordinate of the rectangle.
+ * @param y The y-coordinate of the rectangle.
+ * @param width The width of the rectangle, nothing is added if not positive.
+ * @param height The height of the rectangle, nothing is added if not
+ * positive.
+ */
+void Minesweeper::addPaddingEntity(std::map<std::string, Entity> &entities,
+    const std::string &name, int x, int y, int width, int height)
+{
+    if (width <= 0 || height <= 0)
+        return;
+    Entity padding = createEntity(
+        Shape::RECTANGLE, 0, 0, width, height, x, y,
+        {
+            {DisplayType::TERMINAL, " "},
+            {DisplayType::GRAPHICAL, ""}
+        }
+    );
+    setCellColor(padding, 0, 0, 0);
+    entities[name] = padding;
+}
+
+/**
+ * @brief Brings the cached board entities up to date.
+ *
+ * The whole board is rebuilt when its size or the asset pack changed,
+ * otherwise only the cells marked dirty since the last frame are.
+ */
+void Minesweeper::updateBoardEntities()
+{
+    if (_isBoardDirty) {
+        _boardEntities.clear();
+        addCellEntities(_boardEntities);
+        _cellEntities.assign(_width * _height, nullptr);
+        for (int y = 0; y < _height; y++) {
+            for (int x = 0; x < _width; x++) {
+                _cellEntities[_board.index(x, y)] = &_boardEntities[
+                    "cell_" + std::to_string(x) + "_" + std::to_string(y)];
             }
         }
+        _dirtyCells.clear();
+        _isBoardDirty = false;
+        return;
+    }
+    for (int index : _dirtyCells) {
+        int x = index % _width;
+        int y = index / _width;
+        Entity &cell = *_cellEntities[index];
+        applyCellSprite(cell, x, y);
     }
+    _dirtyCells.clear();
 }
 
 /**
- * @brief Gets the appropriate sprite for a cell.
- * 
+ * @brief Marks a cell whose entity must be rebuilt on the next frame.
+ *
  * @param x Cell X coordinate.
  * @param y Cell Y coordinate.
- * @return Sprite mapping for the cell.
- */
-std::map<DisplayType, std::string> Minesweeper::getCellSprite(int x, int y)
-{
-    std::map<DisplayType, std::string> sprite;
-    sprite[DisplayType::TERMINAL] = "O";
-    sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_not_click.jpg";
-
-    if (_board[y][x].isRevealed) {
-        if (_board[y][x].isMine && _board[y][x].State == LOSER) {
-            sprite[DisplayType::TERMINAL] = "💣";
-            sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_bomb_red.jpg";
-        } else if (_board[y][x].isMine) {
-            sprite[DisplayType::TERMINAL] = "X";
-            sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_bomb.jpg";
-        } else if (_board[y][x].adjacentMines > 0) {
-            sprite[DisplayType::TERMINAL] = std::to_string(_board[y][x].adjacentMines);
-            sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_" + std::to_string(_board[y][x].adjacentMines) + ".jpg";
-        } else {
-            sprite[DisplayType::TERMINAL] = " ";
-            sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_empty.jpg";
-        }
-    } else if (_board[y][x].State == FLAGGED) {
-        sprite[DisplayType::TERMINAL] = "🚩";
-        sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_flag.jpg";
-    } else if (_board[y][x].State == QMARK) {
-        sprite[DisplayType::TERMINAL] = "?";
-        sprite[DisplayType::GRAPHICAL] = _Sprite + "minesweeper_question.jpg";
-    }
+ */
+void Minesweeper::markCellDirty(int x, int y)
+{
+    if (!_isBoardDirty)
+        _dirtyCells.push_back(y * _width + x);
+}
 
-    return sprite;
+/**
+ * @brief Gets the kind of sprite of a cell.
+ *
+ * @param x Cell X coordinate.
+ * @param y Cell Y coordinate.
+ * @return The kind of the cell, to look up in an asset pack.
+ */
+CellSprite Minesweeper::getCellSprite(int x, int y)
+{
+    int index = _board.index(x, y);
+    const Cell &cell = _board[index];
+
+    if (_revealedBits.test(index)) {
+        if (_mineBits.test(index) && cell.State == LOSER)
+            return CELL_BOMB_RED;
+        if (_mineBits.test(index))
+            return CELL_BOMB;
+        return static_cast<CellSprite>(CELL_EMPTY + cell.adjacentMines);
+    }
+    if (cell.State == FLAGGED)
+        return CELL_FLAG;
+    if (cell.State == QMARK)
+        return CELL_QUESTION;
+    return CELL_HIDDEN;
 }
 
 /**
@@ -962,7 +1058,7 @@ void Minesweeper::addTimerEntity(std::map<std::string, Entity> &entities)
     if (_timerPaused) {
         elapsedSeconds = _pausedElapsed;
     } else {
-        auto currentTime = std::chrono::steady_clock::now();
+        auto currentTime = _clock.now();
         std::chrono::duration<float> elapsed = currentTime - _startTime;
         elapsedSeconds = elapsed.count();
     }
@@ -996,49 +1092,13 @@ void Minesweeper::addRemainingBombEntity(std::map<std::string, Entity> &entities
     setCellColor(bombLogo, 255, 255, 255);
     entities["bomb_logo"] = bombLogo;
 
-    int flaggedCount = countCellsWithState(FLAGGED);
-    int remaining = _mines - flaggedCount;
+    int remaining = _mines - _flaggedCells;
     int digitWidth = 30, digitHeight = 40, margin = 10;
     int startXBomb = logoX + logoWidth + margin;
     int startYBomb = logoY;
     drawNumber(entities, "remaining_digit_", remaining, startXBomb, startYBomb, digitWidth, digitHeight, 2);
 }
 
-/**
- * @brief Counts the number of cells with a specific state.
- *
- * @param state The state to count.
- * @return Count of cells with the state.
- */
-int Minesweeper::countCellsWithState(CellState state)
-{
-    int count = 0;
-    for (int i = 0; i < _height; i++) {
-        for (int j = 0; j < _width; j++) {
-            if (_board[i][j].State == state)
-                count++;
-        }
-    }
-    return count;
-}
-
-/**
- * @brief Counts the number of flagged mines correctly.
- *
- * @return Number of correctly flagged mines.
- */
-int Minesweeper::countFlaggedMines()
-{
-    int flaggedBombs = 0;
-    for (int i = 0; i < _height; i++) {
-        for (int j = 0; j < _width; j++) {
-            if (_board[i][j].isMine && _board[i][j].State == FLAGGED)
-                flaggedBombs++;
-        }
-    }
-    return flaggedBombs;
-}
-
 /**
  * @brief Adds the smiley entity to the board.
  *
@@ -1138,6 +1198,18 @@ void Minesweeper::setUsername(std::string username)
     _playerName = username;
 }
 
+/**
+ * @brief Set the seed of the random generator
+ *
+ * The same seed and the same first click give the same mine layout.
+ *
+ * @param seed The seed to use
+ */
+void Minesweeper::setSeed(std::uint64_t seed)
+{
+    _random.setSeed(seed);
+}
+
 /**
  * @brief Initializes the game board with given dimensions.
  *
@@ -1146,12 +1218,18 @@ void Minesweeper::setUsername(std::string username)
  */
 void Minesweeper::initBoard(int width, int height)
 {
+    cancelLayoutJob();
     _width = _dificulty.size_x;
     _height = _dificulty.size_y;
-    _board.clear();
-    _board.erase(_board.begin(), _board.end());
-    _board.assign(height, std::vector<Cell>(width));
-    _startTime = std::chrono::steady_clock::now();
+    _board.reset(width, height);
+    _mineBits.reset(width, height);
+    _revealedBits.reset(width, height);
+    _revealedCells = 0;
+    _flaggedCells = 0;
+    _flaggedMines = 0;
+    _explodedCell = -1;
+    _isBoardDirty = true;
+    _startTime = _clock.now();
     _sounds.push_back("assets/music_minesweeper.mp3");
     _score.first = 0;
 }
@@ -1159,85 +1237,179 @@ void Minesweeper::initBoard(int width, int height)
 /**
  * @brief Places mines on the board excluding the first clicked area.
  *
+ * The mines are drawn uniformly among the other cells, in a time linear in
+ * the number of cells whatever the density.
+ *
  * @param firstx The x-coordinate of the first clicked cell.
  * @param firsty The y-coordinate of the first clicked cell.
  */
 void Minesweeper::placeMines(int firstx, int firsty)
 {
-    int mines = 0;
-    while (mines < _mines) {
-        int x = rand() % _width;
-        int y = rand() % _height;
-        if ((std::abs(x - firstx) <= 1) && (std::abs(y - firsty) <= 1))
-            continue;
-        if (_board[y][x].isMine)
-            continue;
-        _board[y][x].isMine = true;
-        mines++;
+    placeMinesUniform(_mineBits, firstx, firsty, _mines, _random);
+    finishMinePlacement();
+}
+
+/**
+ * @brief Completes the board once its mines are placed.
+ *
+ * Counts the flags put on mines before the first click and the adjacent
+ * mines of every cell.
+ */
+void Minesweeper::finishMinePlacement()
+{
+    for (std::size_t i = 0; i < _board.size(); i++) {
+        if (_mineBits.test(i) && _board[i].State == FLAGGED)
+            _flaggedMines++;
     }
+    calculateAdjacentMines();
+    isFirstClick = true;
+}
+
+/**
+ * @brief Starts the generation of a no-guess layout on a worker thread.
+ *
+ * The game keeps running while the layout is searched, the first click is
+ * replayed by updateLayoutJob once it is ready.
+ *
+ * @param firstx The x-coordinate of the first clicked cell.
+ * @param firsty The y-coordinate of the first clicked cell.
+ */
+void Minesweeper::startLayoutJob(int firstx, int firsty)
+{
+    if (_layoutJob.valid())
+        return;
+    _pendingClick = {firstx, firsty};
+    _cancelLayout = false;
+    _layoutJob = std::async(std::launch::async, generateNoGuessLayout,
+        _width, _height, _mines, firstx, firsty, _random.next(),
+        &_cancelLayout);
+}
+
+/**
+ * @brief Applies the no-guess layout once the worker is done with it.
+ */
+void Minesweeper::updateLayoutJob()
+{
+    if (!_layoutJob.valid() ||
+        _layoutJob.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+        return;
+    _mineBits = _layoutJob.get();
+    finishMinePlacement();
+    revealCell(_pendingClick.first, _pendingClick.second);
+    if (checkWin() || checkLose())
+        _isGameOver = true;
+}
+
+/**
+ * @brief Stops the layout being generated, if any, and drops it.
+ */
+void Minesweeper::cancelLayoutJob()
+{
+    if (!_layoutJob.valid())
+        return;
+    _cancelLayout = true;
+    _layoutJob.wait();
+    _layoutJob = std::future<BitGrid>();
 }
 
 /**
  * @brief Calculates the number of adjacent mines for each cell.
+ *
+ * The mines are spread into a byte plane with a border of empty cells, so
+ * that the counts are sums of shifted rows without bounds checks, computed
+ * with SIMD when the CPU supports it.
  */
 void Minesweeper::calculateAdjacentMines()
 {
-    for (int y = 0; y < _height; y++) {
-        for (int x = 0; x < _width; x++) {
-            if (_board[y][x].isMine)
-                continue;
-            for (int i = -1; i <= 1; i++) {
-                for (int j = -1; j <= 1; j++) {
-                    if (i == 0 && j == 0)
-                        continue;
-                    if (x + i < 0 || x + i >= _width)
-                        continue;
-                    if (y + j < 0 || y + j >= _height)
-                        continue;
-                    if (_board[y + j][x + i].isMine)
-                        _board[y][x].adjacentMines++;
-                }
-            }
+    const std::vector<std::uint64_t> &words = _mineBits.getWords();
+    int stride = _width + 2;
+    std::vector<std::uint8_t> plane(stride * (_height + 2), 0);
+    std::vector<std::uint8_t> counts(_width * _height);
+
+    for (std::size_t word = 0; word < words.size(); word++) {
+        for (std::uint64_t bits = words[word]; bits != 0; bits &= bits - 1) {
+            int index = word * 64 + __builtin_ctzll(bits);
+            plane[(index / _width + 1) * stride + index % _width + 1] = 1;
         }
     }
+    countAdjacentMines(plane.data(), _width, _height, counts.data());
+    for (std::size_t i = 0; i < counts.size(); i++) {
+        if (!_mineBits.test(i))
+            _board[i].adjacentMines = counts[i];
+    }
 }
 
 /**
  * @brief Reveals the cell at a given coordinate.
  *
+ * A cell without adjacent mines reveals its neighbours with an iterative
+ * flood fill, so that huge empty areas do not grow the call stack.
+ *
  * @param x The x-coordinate of the cell.
  * @param y The y-coordinate of the cell.
  */
 void Minesweeper::revealCell(int x, int y)
 {
+    int index = 0;
+
     if (x < 0 || x >= _width)
         return;
     if (y < 0 || y >= _height)
         return;
-    if (_board[y][x].State == FLAGGED || _board[y][x].State == QMARK)
+    index = _board.index(x, y);
+    if (_board[index].State == FLAGGED || _board[index].State == QMARK)
+        return;
+    if (!isFirstClick && _isNoGuess) {
+        _smileyState = CLICK;
+        startLayoutJob(x, y);
         return;
-    if (!isFirstClick) {
-        placeMines(x, y);
-        calculateAdjacentMines();
-        isFirstClick = true;
     }
-    if (_board[y][x].isRevealed)
+    if (!isFirstClick)
+        placeMines(x, y);
+    if (_revealedBits.test(index))
         return;
     _smileyState = CLICK;
-    _board[y][x].isRevealed = true;
-    if (!_board[y][x].isMine)
-        _score.first += 50;
-    if (_board[y][x].isMine)
-        return;
-    if (_board[y][x].adjacentMines > 0)
+    if (_mineBits.test(index)) {
+        _revealedBits.set(index);
+        markCellDirty(x, y);
+        _explodedCell = index;
         return;
-    for (int i = -1; i <= 1; i++) {
-        for (int j = -1; j <= 1; j++) {
-            revealCell(x + i, y + j);
+    }
+    revealSafeCell(index);
+    _floodStack.clear();
+    _floodStack.push_back(index);
+    while (!_floodStack.empty()) {
+        int current = _floodStack.back();
+        int cx = current % _width;
+        int cy = current / _width;
+        _floodStack.pop_back();
+        if (_board[current].adjacentMines > 0)
+            continue;
+        for (int ny = std::max(cy - 1, 0); ny <= std::min(cy + 1, _height - 1); ny++) {
+            for (int nx = std::max(cx - 1, 0); nx <= std::min(cx + 1, _width - 1); nx++) {
+                int neighbour = _board.index(nx, ny);
+                if (_revealedBits.test(neighbour) || _board[neighbour].State != NONE)
+                    continue;
+                revealSafeCell(neighbour);
+                _floodStack.push_back(neighbour);
+            }
         }
     }
 }
 
+/**
+ * @brief Reveals a cell without a mine and scores it.
+ *
+ * @param index The index of the cell in the board.
+ */
+void Minesweeper::revealSafeCell(int index)
+{
+    _revealedBits.set(index);
+    _revealedCells++;
+    _score.first += 50;
+    markCellDirty(index % _width, index / _width);
+}
+
 /**
  * @brief Toggles flag or question mark on a cell.
  *
@@ -1250,14 +1422,23 @@ void Minesweeper::flagCell(int x, int y)
         return;
     if (y < 0 || y >= _height)
         return;
-    if (_board[y][x].State == FLAGGED) {
-        _board[y][x].State = QMARK;
+    int index = _board.index(x, y);
+    Cell &cell = _board[index];
+    int mine = _mineBits.test(index) ? 1 : 0;
+
+    markCellDirty(x, y);
+    if (cell.State == FLAGGED) {
+        cell.State = QMARK;
+        _flaggedCells--;
+        _flaggedMines -= mine;
     }
-    else if (_board[y][x].State == NONE) {
-        _board[y][x].State = FLAGGED;
+    else if (cell.State == NONE) {
+        cell.State = FLAGGED;
+        _flaggedCells++;
+        _flaggedMines += mine;
     }
-    else if (_board[y][x].State == QMARK) {
-        _board[y][x].State = NONE;
+    else if (cell.State == QMARK) {
+        cell.State = NONE;
     }
 }
 
@@ -1268,14 +1449,10 @@ void Minesweeper::flagCell(int x, int y)
  */
 bool Minesweeper::checkWin()
 {
-    for (int y = 0; y < _height; y++) {
-        for (int x = 0; x < _width; x++) {
-            if (!_board[y][x].isMine && !_board[y][x].isRevealed)
-                return false;
-        }
-    }
+    if (_revealedCells < _width * _height - _mines)
+        return false;
     if (!_timerPaused) {
-        auto currentTime = std::chrono::steady_clock::now();
+        auto currentTime = _clock.now();
         std::chrono::duration<float> elapsed = currentTime - _startTime;
         _pausedElapsed = elapsed.count();
         _timerPaused = true;
@@ -1294,8 +1471,8 @@ bool Minesweeper::checkWin()
 int Minesweeper::calculateBonusScore()
 {
     int bonus = 0;
-    bonus += countFlaggedMines() * 200;
-    auto currentTime = std::chrono::steady_clock::now();
+    bonus += _flaggedMines * 200;
+    auto currentTime = _clock.now();
     std::chrono::duration<float> elapsed = currentTime - _startTime;
     int elapsedSeconds = static_cast<int>(elapsed.count());
     int remainingTime = _timeLimit - elapsedSeconds;
@@ -1312,8 +1489,11 @@ void Minesweeper::revealBombs()
 {
     for (int y = 0; y < _height; y++) {
         for (int x = 0; x < _width; x++) {
-            if (_board[y][x].isMine)
-                _board[y][x].isRevealed = true;
+            int index = _board.index(x, y);
+            if (_mineBits.test(index) && !_revealedBits.test(index)) {
+                _revealedBits.set(index);
+                markCellDirty(x, y);
+            }
         }
     }
 }
@@ -1325,26 +1505,22 @@ void Minesweeper::revealBombs()
  */
 bool Minesweeper::checkLose()
 {
-    for (int y = 0; y < _height; y++) {
-        for (int x = 0; x < _width; x++) {
-            if (_board[y][x].isMine && _board[y][x].isRevealed) {
-                _board[y][x].State = LOSER;
-                _sounds.push_back(_Sprite + "boom.ogg");
-                revealBombs();
-                _score.first += countFlaggedMines() * 200;
-                _state = GAME_LOSE;
-                _smileyState = LOSE;
-                if (!_timerPaused) {
-                    auto currentTime = std::chrono::steady_clock::now();
-                    std::chrono::duration<float> elapsed = currentTime - _startTime;
-                    _pausedElapsed = elapsed.count();
-                    _timerPaused = true;
-                }
-                return true;
-            }
-        }
+    if (_explodedCell < 0)
+        return false;
+    _board[_explodedCell].State = LOSER;
+    markCellDirty(_explodedCell % _width, _explodedCell / _width);
+    _sounds.push_back(_Sprite + "boom.ogg");
+    revealBombs();
+    _score.first += _flaggedMines * 200;
+    _state = GAME_LOSE;
+    _smileyState = LOSE;
+    if (!_timerPaused) {
+        auto currentTime = _clock.now();
+        std::chrono::duration<float> elapsed = currentTime - _startTime;
+        _pausedElapsed = elapsed.count();
+        _timerPaused = true;
     }
-    return false;
+    return true;
 }
 
 /**
@@ -8,8 +8,15 @@
 #ifndef MINESWEEPER_HPP_
     #define MINESWEEPER_HPP_
 
+    #include <atomic>
+    #include <future>
     #include <vector>
     #include "../interfaces/IGame.hpp"
+    #include "../utils/BitGrid.hpp"
+    #include "../utils/GameClock.hpp"
+    #include "../utils/Grid2D.hpp"
+    #include "../utils/Random.hpp"
+    #include "../utils/SpriteManifest.hpp"
     #include <map>
     #include <string>
     #include <chrono>
@@ -19,6 +26,19 @@
 
     #define LIBRARY_NAME "Minesweeper"
 
+    // "<width>x<height>x<mines>" board replacing the default difficulty
+    #define MINESWEEPER_BOARD_ENV "ARCADE_MINESWEEPER_BOARD"
+    #define MINESWEEPER_MAX_SIZE 512
+    // Set to anything but "0" to only deal layouts solvable without guessing
+    #define MINESWEEPER_NO_GUESS_ENV "ARCADE_MINESWEEPER_NO_GUESS"
+
+    // Asset packs, cycled with F1 and F2; each directory holds the sprites
+    // of the interface and the manifest of the cells
+    #define MINESWEEPER_ASSET_PACKS {"assets/Minesweeper_1/", "assets/M_2/"}
+    #define MINESWEEPER_CELLS_MANIFEST "cells.pack"
+    #define MINESWEEPER_SPRITE_KINDS {"hidden", "flag", "question", "bomb", \
+        "bomb_red", "empty", "1", "2", "3", "4", "5", "6", "7", "8"}
+
 enum CellState {
     NONE,
     QMARK,
@@ -26,13 +46,33 @@ enum CellState {
     LOSER
 };
 
+/**
+ * @brief Player state of a cell
+ *
+ * Whether the cell holds a mine or is revealed is stored in the bitsets of
+ * the board, so that the flood fill and the win check stay cache-friendly.
+ */
 struct Cell {
-    bool isMine = false;
     CellState State = NONE;
-    bool isRevealed = false;
     int adjacentMines = 0;
 };
 
+/**
+ * @brief Kinds of the sprites of a cell, in the order of
+ * MINESWEEPER_SPRITE_KINDS
+ *
+ * A revealed cell next to n mines is drawn with CELL_EMPTY + n.
+ */
+enum CellSprite {
+    CELL_HIDDEN,
+    CELL_FLAG,
+    CELL_QUESTION,
+    CELL_BOMB,
+    CELL_BOMB_RED,
+    CELL_EMPTY,
+    CELL_COUNT = CELL_EMPTY + 9
+};
+
 class Minesweeper : public IGame {
     public:
         Minesweeper();
@@ -43,22 +83,32 @@ class Minesweeper : public IGame {
         bool isGameEnd(void) override;
         std::string getNewLib(void) override;
         void handleEvent(std::vector<RawEvent>) override;
+        void update(double dt) override;
+        void fixedUpdate(double dt) override;
+        void setInterpolation(double alpha) override;
         std::map<std::string, Entity> renderGame() override;
         std::string getNewDisplay(void) override;
         std::string getName(void) override;
         void setUsername(std::string username) final;
+        void setSeed(std::uint64_t seed) final;
 
     protected:
         // Board initialization and calculation
         void initBoard(int width, int height);
         void placeMines(int firstx, int firsty);
+        void finishMinePlacement();
+        void startLayoutJob(int firstx, int firsty);
+        void updateLayoutJob();
+        void cancelLayoutJob();
         void calculateAdjacentMines();
 
         // Game action methods
         void revealCell(int x, int y);
+        void revealSafeCell(int index);
         void flagCell(int x, int y);
         bool checkWin();
         void select_dificulty(int width, int height, int mines);
+        void loadBoardFromEnv(void);
         bool checkLose();
         void revealBombs();
 
@@ -81,19 +131,22 @@ class Minesweeper : public IGame {
         Entity createTextEntity(const std::string &text, int x, int y, int size);
         Entity createBackgroundEntity(const std::string &spritePath);
         void setSprite();
+        void loadAssetPacks();
 
         // Board rendering methods
         void addSoundEntities(std::map<std::string, Entity> &entities);
         void addMenuTitleEntities(std::map<std::string, Entity> &entities);
         void addMenuButtonEntities(std::map<std::string, Entity> &entities);
         void addCellEntities(std::map<std::string, Entity> &entities);
+        void addPaddingEntity(std::map<std::string, Entity> &entities,
+            const std::string &name, int x, int y, int width, int height);
+        void updateBoardEntities();
+        void markCellDirty(int x, int y);
         void addGameUIElements(std::map<std::string, Entity> &entities);
-        std::map<DisplayType, std::string> getCellSprite(int x, int y);
+        CellSprite getCellSprite(int x, int y);
         void addSmileyEntity(std::map<std::string, Entity> &entities);
 
         // Board state calculation helpers
-        int countCellsWithState(CellState state);
-        int countFlaggedMines();
         int calculateBonusScore();
         void resetGame();
 
@@ -102,7 +155,7 @@ class Minesweeper : public IGame {
         std::map<std::string, Entity> printWinOrLose();
         std::map<std::string, Entity> printMenu();
         std::map<std::string, Entity> printBoard();
-        void setCellColor(Entity &entity, int x, int y);
+        void applyCellSprite(Entity &entity, int x, int y);
 
         // Event handling methods
         void handleEventGame(std::vector<RawEvent> events);
@@ -154,13 +207,27 @@ class Minesweeper : public IGame {
         int _height;
         int _mines;
 
+        GameClock _clock;
         std::chrono::steady_clock::time_point _startTime;
         float _pausedElapsed = 0.0f;
         bool _timerPaused = false;
 
-        std::vector<std::vector<Cell>> _board;
+        Grid2D<Cell> _board;
+        BitGrid _mineBits;
+        BitGrid _revealedBits;
+        std::vector<int> _floodStack;
+
+        // Board entities kept between frames, only the dirty cells are rebuilt
+        std::map<std::string, Entity> _boardEntities;
+        std::vector<Entity *> _cellEntities;
+        std::vector<int> _dirtyCells;
+        bool _isBoardDirty = true;
         std::pair<float, std::string> _score;
         SmileyState _smileyState = SMILEY;
+        int _smileyFrames = 0;
+        int _blinkCount = 0;
+        int _easterEggAngle = 0;
+        bool _isShiftActive = false;
         std::string _name;
 
         Minesweeper_dificulty _dificulty = {30, 16, 99, HARD};
@@ -173,8 +240,11 @@ class Minesweeper : public IGame {
 
         int _timeLimit = 300;
         int _remainingMines = 0;
+        // Board counters, kept up to date by revealCell and flagCell
+        int _flaggedCells = 0;
         int _flaggedMines = 0;
         int _revealedCells = 0;
+        int _explodedCell = -1;
 
         std::string _Sprite = "assets/Minesweeper_1/";
 
@@ -182,7 +252,17 @@ class Minesweeper : public IGame {
         std::string _playerName = "Enter Name";
         bool _isNameInputActive = false;
 
-        int _assetPack = 0;
+        std::vector<std::string> _assetPackDirs = MINESWEEPER_ASSET_PACKS;
+        std::vector<SpriteManifest> _assetPacks;
+        std::size_t _assetPack = 0;
+
+        Random _random;
+
+        // No-guess layout generated on a worker thread at the first click
+        bool _isNoGuess = false;
+        std::future<BitGrid> _layoutJob;
+        std::atomic<bool> _cancelLayout{false};
+        std::pair<int, int> _pendingClick;
 };
 
 #endif /* !MINESWEEPER_HPP_ */
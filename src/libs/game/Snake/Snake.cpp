@@ -6,14 +6,24 @@
 */
 
 #include "Snake.hpp"
-#include <thread>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iterator>
 
 Snake::Snake()
 {
+    const char *length = std::getenv(SNAKE_LENGTH_ENV);
+
+    if (length)
+        snake.length = std::max(SNAKE_DEFAULT_LENGTH, std::atoi(length));
+    loadGridFromEnv();
     createGrid(gridWidth, gridHeight);
-    lastMoveTime = std::chrono::steady_clock::now();
-    _lastFrameTime = std::chrono::steady_clock::now();
+    loadAssetPacks();
+    resetTimers();
     direction = UP;
+    _turns.reset(SNAKE_TURN_BUFFER);
+    _nextTempFoodInterval = _random.range(15, 25);
 }
 
 Snake::~Snake()
@@ -33,38 +43,101 @@ Snake::~Snake()
  */
 void Snake::createGrid(int width, int height)
 {
-    grid.resize(height, std::vector<Cell>(width));
+    grid.isWall.reset(width, height);
+    grid.isSnake.reset(width, height);
+    grid.isFood.reset(width, height);
+    grid.isTimeFood.reset(width, height);
+    grid.isTempFood.reset(width, height);
+    grid.freeCells.reset(width * height);
+    grid.food.reset(width * height);
+    grid.tempFood = -1;
+    snake.body.reset(width * height);
     for (int y = 0; y < height; ++y) {
         for (int x = 0; x < width; ++x) {
-            grid[y][x].pos.x = x;
-            grid[y][x].pos.y = y;
             if (x == 0 || x == width - 1 || y == 0 || y == height - 1) {
-                grid[y][x].isWall = true;
+                grid.isWall.set(x, y);
             }
         }
     }
-    snake.body.push_back({width / 2, height / 2});
-    snake.body.push_back({width / 2, height / 2 + 1});
-    snake.body.push_back({width / 2, height / 2 + 2});
-    snake.body.push_back({width / 2, height / 2 + 3});
-    for (const auto& segment : snake.body) {
-        grid[segment.y][segment.x].isSnake = true;
+    placeSnake(width, height);
+    for (size_t i = 0; i < snake.body.size(); i++) {
+        grid.isSnake.set(snake.body[i].x, snake.body[i].y);
+    }
+    for (int index = 0; index < width * height; ++index) {
+        if (!grid.isWall.test(index) && !grid.isSnake.test(index))
+            grid.freeCells.insert(index);
     }
     generateFood(false, false);
 }
 
+/**
+ * @brief Replaces the default grid size by the one given in the environment.
+ *
+ * ARCADE_SNAKE_GRID holds "<width>x<height>". Grids too large for the view
+ * are drawn with smaller cells, then scrolled around the head.
+ */
+void Snake::loadGridFromEnv(void)
+{
+    const char *size = std::getenv(SNAKE_GRID_ENV);
+    int width = 0;
+    int height = 0;
+
+    if (!size)
+        return;
+    if (std::sscanf(size, "%dx%d", &width, &height) != 2 ||
+        width < SNAKE_MIN_GRID || height < SNAKE_MIN_GRID ||
+        width > SNAKE_MAX_GRID || height > SNAKE_MAX_GRID) {
+        std::cerr << "Invalid " << SNAKE_GRID_ENV << ": " << size << std::endl;
+        return;
+    }
+    gridWidth = width;
+    gridHeight = height;
+}
+
+/**
+ * @brief Places the initial body of the snake.
+ *
+ * The default snake stands vertically in the center of the grid. A longer
+ * one, asked through ARCADE_SNAKE_LENGTH, is folded row by row from the
+ * bottom of the grid, with its head on the top row of the body. The top
+ * row of the grid is always kept free so the snake can move.
+ *
+ * @param width The width of the grid.
+ * @param height The height of the grid.
+ */
+void Snake::placeSnake(int width, int height)
+{
+    int innerWidth = width - 2;
+    int length = std::min(snake.length, innerWidth * (height - 3));
+
+    if (length <= SNAKE_DEFAULT_LENGTH) {
+        for (int i = 0; i < SNAKE_DEFAULT_LENGTH; i++)
+            snake.body.pushBack({width / 2, height / 2 + i});
+        return;
+    }
+    for (int i = 0; i < length; i++) {
+        int row = i / innerWidth;
+        int column = i % innerWidth;
+        if (row % 2 == 1)
+            column = innerWidth - 1 - column;
+        snake.body.pushFront({column + 1, height - 2 - row});
+    }
+}
+
 /**
  * @brief Checks if the game is over.
  *
  * This function checks if the game is over by checking if the snake has collided
- * with itself or a wall. If the game is over, it resets the game state and
- * returns true.
+ * with itself or a wall. A lost game is reported once: the snake stays dead
+ * on screen during SNAKE_GAME_OVER_DELAY, and the core saves the score on
+ * every frame this returns true.
  *
- * @return true if the game is over, false otherwise.
+ * @return true on the first call after the game is lost, false otherwise.
  */
 bool Snake::isGameOver(void)
 {
-    if (gameOver) {
+    if (gameOver && !_isGameOverReported) {
+        _isGameOverReported = true;
         return true;
     }
     return false;
@@ -113,11 +186,12 @@ std::string Snake::getNewLib(void)
 }
 
 /**
- * @brief Returns the name of the game.
+ * @brief Handles the asset pack keys and buffers the turns of the frame.
  *
- * This function returns the name of the game.
+ * The turns are buffered in the order they were pressed, from the
+ * timestamps of the events, whatever the order the display gave them in.
  *
- * @return std::string The name of the game.
+ * @param events The events of the frame.
  */
 void Snake::setDirection(std::vector<RawEvent> events)
 {
@@ -125,31 +199,78 @@ void Snake::setDirection(std::vector<RawEvent> events)
         if (event.type == EventType::PRESS) {
             switch (event.key) {
                 case KEYBOARD_F1:
-                    if (assetPack == 0) {
-                        assetPack = 2;
-                    } else {
-                        assetPack -= 1;
-                    }
+                    assetPack = (assetPack + _assetPacks.size() - 1) %
+                        _assetPacks.size();
                     break;
                 case KEYBOARD_F2:
-                    if (assetPack == 2) {
-                        assetPack = 0;
-                    } else {
-                        assetPack += 1;
-                    }
+                    assetPack = (assetPack + 1) % _assetPacks.size();
                     break;
                 default:
                     break;
             }
         }
     }
+    _frameTurns.clear();
     for (const auto& event : events) {
-        if (event.type == EventType::PRESS &&
-            (event.key == KEYBOARD_UP || event.key == KEYBOARD_DOWN ||
-             event.key == KEYBOARD_LEFT || event.key == KEYBOARD_RIGHT)) {
-            _bufferedEvents.push(event);
+        if (event.type != EventType::PRESS) {
+            continue;
         }
+        switch (event.key) {
+            case KEYBOARD_UP:
+                _frameTurns.push_back({UP, event.timestamp});
+                break;
+            case KEYBOARD_DOWN:
+                _frameTurns.push_back({DOWN, event.timestamp});
+                break;
+            case KEYBOARD_LEFT:
+                _frameTurns.push_back({LEFT, event.timestamp});
+                break;
+            case KEYBOARD_RIGHT:
+                _frameTurns.push_back({RIGHT, event.timestamp});
+                break;
+            default:
+                break;
+        }
+    }
+    std::stable_sort(_frameTurns.begin(), _frameTurns.end(),
+        [](const Turn &a, const Turn &b) { return a.timestamp < b.timestamp; });
+    for (const Turn &turn : _frameTurns) {
+        queueTurn(turn);
+    }
+}
+
+/**
+ * @brief Checks if two directions are opposite.
+ *
+ * @param a The first direction.
+ * @param b The second direction.
+ * @return true if the snake cannot turn from one to the other.
+ */
+static bool isOpposite(Direction a, Direction b)
+{
+    return (a == UP && b == DOWN) || (a == DOWN && b == UP) ||
+        (a == LEFT && b == RIGHT) || (a == RIGHT && b == LEFT);
+}
+
+/**
+ * @brief Buffers a turn, to be applied on one of the next moves.
+ *
+ * The turn is compared to the direction the snake will have once the
+ * buffered turns are applied: it is dropped if it keeps or reverses it,
+ * so every buffered turn takes effect. It is also dropped when
+ * SNAKE_TURN_BUFFER turns are already waiting.
+ *
+ * @param turn The direction pressed and the time of the press.
+ */
+void Snake::queueTurn(const Turn &turn)
+{
+    Direction last = _turns.empty() ? direction : _turns.back().direction;
+
+    if (_turns.full() || turn.direction == last ||
+        isOpposite(turn.direction, last)) {
+        return;
     }
+    _turns.pushBack(turn);
 }
 
 /**
@@ -164,28 +285,93 @@ void Snake::setDirection(std::vector<RawEvent> events)
  */
 void Snake::setFrameRate(bool speed, bool up, bool reset)
 {
-    static int previousFrameRate = 10;
-
     if (reset) {
-        previousFrameRate = 10;
+        _previousFrameRate = 10;
         _frameRate = 10;
     }
     if (up) {
         _frameRate += 2;
-        previousFrameRate = _frameRate;
+        _previousFrameRate = _frameRate;
     }
     if (_frameRate > 35) {
         _frameRate = 35;
-        previousFrameRate = _frameRate;
+        _previousFrameRate = _frameRate;
     }
     if (speed) {
         if (_frameRate < 35) {
-            previousFrameRate = _frameRate;
+            _previousFrameRate = _frameRate;
         }
         _frameRate = 35;
     } else {
-        _frameRate = previousFrameRate;
+        _frameRate = _previousFrameRate;
+    }
+}
+
+/**
+ * @brief Restarts the timers of the game from the current time.
+ *
+ * Called when a game starts, so that the speed, the time food and the
+ * temporary food are counted from the start of each game.
+ */
+void Snake::resetTimers()
+{
+    auto currentTime = _clock.now();
+
+    _moveElapsed = 0;
+    _lastSpeedIncreaseTime = currentTime;
+    _lastFruitSpawnTime = currentTime;
+    _lastTempFoodSpawnTime = currentTime;
+    _tempFoodPlacedTime = currentTime;
+    _isTempFoodActive = false;
+}
+
+/**
+ * @brief Advances the clock of the game and runs the timers it passed.
+ *
+ * @param dt The time elapsed since the previous frame, in seconds.
+ */
+void Snake::update(double dt)
+{
+    _clock.advance(dt);
+    _timers.run(_clock.now());
+}
+
+/**
+ * @brief Moves the snake once 1 / _frameRate seconds of fixed steps went by.
+ *
+ * The time past the move is kept for the next one, so the snake keeps its
+ * speed whatever the duration of the steps.
+ *
+ * @param dt The duration of the step, in seconds.
+ */
+void Snake::fixedUpdate(double dt)
+{
+    double moveInterval = 1.0 / _frameRate;
+
+    _stepDuration = dt;
+    if (!_gameStart || gameOver || _isGameOverDelay) {
+        _moveElapsed = 0;
+        return;
+    }
+    _moveElapsed += dt;
+    if (_moveElapsed < moveInterval) {
+        return;
+    }
+    _moveElapsed -= moveInterval;
+    if (_moveElapsed >= moveInterval) {
+        _moveElapsed = 0;
     }
+    moveSnake();
+}
+
+/**
+ * @brief Sets the share of a fixed step elapsed since the last one.
+ *
+ * @param alpha The interpolation alpha given by the core.
+ */
+void Snake::setInterpolation(double alpha)
+{
+    _interpolation = alpha;
 }
 
 /**
@@ -196,13 +382,12 @@ void Snake::setFrameRate(bool speed, bool up, bool reset)
  */
 void Snake::shouldIncreaseSpeed(void)
 {
-    static auto lastSpeedIncreaseTime = std::chrono::steady_clock::now();
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastSpeedIncreaseTime).count();
+    auto currentTime = _clock.now();
+    auto elapsedTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - _lastSpeedIncreaseTime).count();
 
     if (elapsedTime >= 10) {
         setFrameRate(false, true, false);
-        lastSpeedIncreaseTime = currentTime;
+        _lastSpeedIncreaseTime = currentTime;
     }
 }
 
@@ -230,6 +415,9 @@ void Snake::handleEvent(std::vector<RawEvent> events)
             setFrameRate(false, false, false);
         }
     }
+    if (_isGameOverDelay) {
+        return;
+    }
     if (gameOver && _gameStart) {
         moveSnake();
         return;
@@ -246,31 +434,6 @@ void Snake::handleEvent(std::vector<RawEvent> events)
     }
     shouldIncreaseSpeed();
     setDirection(events);
-    if (shouldMoveSnake()) {
-        moveSnake();
-    }
-}
-
-/**
- * @brief Use the chrono library to check if the snake should move.
- *
- * This function checks if the snake should move based on the elapsed time
- * since the last move. It returns true if the snake should move, false
- * otherwise.
- *
- * @return true if the snake should move, false otherwise.
- */
-bool Snake::shouldMoveSnake(void)
-{
-    auto currentTime = std::chrono::steady_clock::now();
-    auto elapsedTime = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastMoveTime).count();
-    int moveInterval = 1000 / _frameRate;
-
-    if (elapsedTime >= moveInterval) {
-        lastMoveTime = currentTime;
-        return true;
-    }
-    return false;
 }
 
 /**
@@ -287,12 +450,11 @@ bool Snake::shouldSpawnFruit()
     if (_PlayTime < 5) {
         return false;
     }
-    static auto lastFruitSpawnTime = std::chrono::steady_clock::now();
-    auto currentTime = std::chrono::steady_clock::now();
-    auto fruitSpawnElapsedTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - lastFruitSpawnTime).count();
+    auto currentTime = _clock.now();
+    auto fruitSpawnElapsedTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - _lastFruitSpawnTime).count();
 
     if (fruitSpawnElapsedTime >= 5) {
-        lastFruitSpawnTime = currentTime;
+        _lastFruitSpawnTime = currentTime;
         return true;
     }
     return false;
@@ -304,78 +466,73 @@ void Snake::handleTempFood()
     if (_PlayTime < 15) {
         return;
     }
-    static auto lastTempFoodSpawnTime = std::chrono::steady_clock::now();
-    static bool tempFoodActive = false;
-    static auto tempFoodPlacedTime = std::chrono::steady_clock::now();
-    static int nextSpawnInterval = 15 + (rand() % 11);
-
-    auto currentTime = std::chrono::steady_clock::now();
-    bool tempFoodExists = false;
-    for (int y = 0; y < gridHeight && !tempFoodExists; ++y) {
-        for (int x = 0; x < gridWidth && !tempFoodExists; ++x) {
-            if (grid[y][x].isFood && grid[y][x].isTempFood) {
-                tempFoodExists = true;
-            }
-        }
-    }
-    if (tempFoodActive && !tempFoodExists) {
-        tempFoodActive = false;
+    auto currentTime = _clock.now();
+    bool tempFoodExists = grid.tempFood >= 0;
+    if (_isTempFoodActive && !tempFoodExists) {
+        _isTempFoodActive = false;
     }
-    if (tempFoodActive) {
+    if (_isTempFoodActive) {
         auto tempFoodElapsedTime = std::chrono::duration_cast<std::chrono::seconds>(
-            currentTime - tempFoodPlacedTime).count();
+            currentTime - _tempFoodPlacedTime).count();
         if (tempFoodElapsedTime >= 5) {
-            for (int y = 0; y < gridHeight; ++y) {
-                for (int x = 0; x < gridWidth; ++x) {
-                    if (grid[y][x].isFood && grid[y][x].isTempFood) {
-                        grid[y][x].isFood = false;
-                        grid[y][x].isTempFood = false;
-                    }
-                }
-            }
-            tempFoodActive = false;
+            int index = grid.tempFood;
+            removeFood(index);
+            grid.freeCells.insert(index);
+            _isTempFoodActive = false;
         }
     }
     auto elapsedSinceLastSpawn = std::chrono::duration_cast<std::chrono::seconds>(
-        currentTime - lastTempFoodSpawnTime).count();
-    if (!tempFoodActive && elapsedSinceLastSpawn >= nextSpawnInterval) {
+        currentTime - _lastTempFoodSpawnTime).count();
+    if (!_isTempFoodActive && elapsedSinceLastSpawn >= _nextTempFoodInterval) {
         generateFood(false, true);
         _specialFruitSpawn += 1;
-        tempFoodActive = true;
-        tempFoodPlacedTime = currentTime;
-        lastTempFoodSpawnTime = currentTime;
-        nextSpawnInterval = 15 + (rand() % 11);
+        _isTempFoodActive = true;
+        _tempFoodPlacedTime = currentTime;
+        _lastTempFoodSpawnTime = currentTime;
+        _nextTempFoodInterval = _random.range(15, 25);
     }
 }
 
 /**
- * @brief Generates food on the grid using an optimized algorithm.
+ * @brief Generates food on a random free cell.
+ *
+ * The cell is drawn from the free cell set, so spawning takes a constant
+ * time whatever the size of the grid and of the snake.
  *
  * @param timeFood Indicates whether to generate time food.
+ * @param isTempFood Indicates whether to generate temporary food.
  */
 void Snake::generateFood(bool timeFood, bool isTempFood)
 {
-    int foodCount = 0;
-    std::vector<std::pair<int, int>> emptyCells;
-
-    for (int y = 0; y < gridHeight; ++y) {
-        for (int x = 0; x < gridWidth; ++x) {
-            if (grid[y][x].isFood) {
-                foodCount++;
-            } else if (!grid[y][x].isWall && !grid[y][x].isSnake) {
-                emptyCells.push_back({x, y});
-            }
-        }
+    if (grid.food.size() >= 3 && !isTempFood) {
+        return;
     }
-    if ((foodCount >= 3 || emptyCells.empty()) && !isTempFood) {
+    if (grid.freeCells.empty()) {
         return;
     }
-    int index = rand() % emptyCells.size();
-    int x = emptyCells[index].first;
-    int y = emptyCells[index].second;
-    grid[y][x].isFood = true;
-    grid[y][x].isTimeFood = timeFood;
-    grid[y][x].isTempFood = isTempFood;
+    int index = grid.freeCells[_random.below(grid.freeCells.size())];
+    grid.freeCells.erase(index);
+    grid.food.insert(index);
+    grid.isFood.set(index);
+    grid.isTimeFood.set(index, timeFood);
+    grid.isTempFood.set(index, isTempFood);
+    if (isTempFood)
+        grid.tempFood = index;
+}
+
+/**
+ * @brief Removes a food from the grid, the cell is left to the caller.
+ *
+ * @param index The index of the food cell.
+ */
+void Snake::removeFood(int index)
+{
+    grid.food.erase(index);
+    grid.isFood.set(index, false);
+    grid.isTimeFood.set(index, false);
+    grid.isTempFood.set(index, false);
+    if (grid.tempFood == index)
+        grid.tempFood = -1;
 }
 
 /**
@@ -386,8 +543,8 @@ void Snake::generateFood(bool timeFood, bool isTempFood)
  */
 void Snake::eatFood()
 {
-    bool isTimeFood = grid[snake.body[0].y][snake.body[0].x].isTimeFood;
-    bool isTempFood = grid[snake.body[0].y][snake.body[0].x].isTempFood;
+    bool isTimeFood = grid.isTimeFood.test(snake.body[0].x, snake.body[0].y);
+    bool isTempFood = grid.isTempFood.test(snake.body[0].x, snake.body[0].y);
 
     _fruitEat += 1;
     _score.first += 10;
@@ -395,9 +552,7 @@ void Snake::eatFood()
         _specialFruitEat += 1;
         _score.first += 5;
     }
-    grid[snake.body[0].y][snake.body[0].x].isFood = false;
-    grid[snake.body[0].y][snake.body[0].x].isTimeFood = false;
-    grid[snake.body[0].y][snake.body[0].x].isTempFood = false;
+    removeFood(grid.isFood.index(snake.body[0].x, snake.body[0].y));
 
     _sounds.push_back("assets/food.ogg");
     if (isTimeFood || isTempFood) {
@@ -411,29 +566,9 @@ void Snake::eatFood()
  */
 void Snake::moveSnake()
 {
-    if (!_bufferedEvents.empty()) {
-        RawEvent buffered = _bufferedEvents.front();
-        _bufferedEvents.pop();
-        switch (buffered.key) {
-            case KEYBOARD_UP:
-                if (direction != DOWN)
-                    direction = UP;
-                break;
-            case KEYBOARD_DOWN:
-                if (direction != UP)
-                    direction = DOWN;
-                break;
-            case KEYBOARD_LEFT:
-                if (direction != RIGHT)
-                    direction = LEFT;
-                break;
-            case KEYBOARD_RIGHT:
-                if (direction != LEFT)
-                    direction = RIGHT;
-                break;
-            default:
-                break;
-        }
+    if (!_turns.empty()) {
+        direction = _turns.front().direction;
+        _turns.popFront();
     }
     Position newHead = snake.body[0];
     switch (this->direction) {
@@ -454,237 +589,41 @@ void Snake::moveSnake()
         gameOver = true;
         return;
     }
-    if (grid[newHead.y][newHead.x].isWall) {
+    if (grid.isWall.test(newHead.x, newHead.y)) {
         gameOver = true;
         return;
     }
-    if (grid[newHead.y][newHead.x].isSnake) {
+    if (grid.isSnake.test(newHead.x, newHead.y)) {
         gameOver = true;
         return;
     }
     handleTempFood();
-    bool foodEaten = grid[newHead.y][newHead.x].isFood;
-    snake.body.insert(snake.body.begin(), newHead);
-    grid[newHead.y][newHead.x].isSnake = true;
+    bool foodEaten = grid.isFood.test(newHead.x, newHead.y);
+    snake.body.pushFront(newHead);
+    grid.isSnake.set(newHead.x, newHead.y);
     if (!foodEaten) {
         Position tail = snake.body.back();
-        snake.body.pop_back();
-        grid[tail.y][tail.x].isSnake = false;
+        snake.body.popBack();
+        grid.isSnake.set(tail.x, tail.y, false);
+        grid.freeCells.erase(grid.isSnake.index(newHead.x, newHead.y));
+        grid.freeCells.insert(grid.isSnake.index(tail.x, tail.y));
     } else {
         eatFood();
     }
 }
 
-/**
- * @brief Sets the color of the grid cell.
- *
- * This function sets the color of the grid cell based on the RGB values
- * provided. It updates the RGB values of the entity.
- *
- * @param entity The entity representing the grid cell.
- * @param r The red component of the color.
- * @param g The green component of the color.
- * @param b The blue component of the color.
- */
-void Snake::setGridColor(Entity& entity, int r, int g, int b)
-{
-    entity.RGB[0] = r;
-    entity.RGB[1] = g;
-    entity.RGB[2] = b;
-}
-
-/**
- * @brief Loads the first asset pack for the grid cell.
- *
- * This function loads the first asset pack for the grid cell based on its
- * properties (wall, snake, food, etc.). It sets the appropriate sprites and
- * colors for the entity representing the grid cell.
- *
- * @param x The x-coordinate of the grid cell.
- * @param y The y-coordinate of the grid cell.
- * @param entity The entity representing the grid cell.
- * @param entities The map of entities to store the loaded assets.
- */
-void Snake::LoadFirstAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities)
-{
-    if (grid[y][x].isWall) {
-        setGridColor(entity, 255, 0, 0);
-        entity.sprites[DisplayType::TERMINAL] = "A";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/wall.png";
-    } else if (grid[y][x].isSnake) {
-        setGridColor(entity, 0, 255, 255);
-        entity.sprites[DisplayType::TERMINAL] = "S";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/snake.png";
-        if (snake.body.front().x == x && snake.body.front().y == y) {
-            setGridColor(entity, 255, 0, 255);
-            entity.sprites[DisplayType::TERMINAL] = "H";
-            switch (this->direction) {
-                case UP:
-                    entity.rotate = 180;
-                    break;
-                case DOWN:
-                    entity.rotate = 0;
-                    break;
-                case LEFT:
-                    entity.rotate = 90;
-                    break;
-                case RIGHT:
-                    entity.rotate = 270;
-                    break;
-            }
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/head.png";
-        }
-        if (gameOver) {
-            setGridColor(entity, 255, 0, 0);
-            entity.sprites[DisplayType::TERMINAL] = "X";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/dead_snake.png";
-            if (snake.body.front().x == x && snake.body.front().y == y) {
-                setGridColor(entity, 255, 0, 255);
-                entity.sprites[DisplayType::TERMINAL] = "H";
-                entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/dead_head.png";
-            }
-        }
-    } else if (grid[y][x].isFood) {
-        setGridColor(entity, 0, 255, 0);
-        entity.sprites[DisplayType::TERMINAL] = "F";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/apple.png";
-        if (grid[y][x].isTempFood) {
-            setGridColor(entity, 255, 255, 0);
-            entity.sprites[DisplayType::TERMINAL] = "T";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/temp_apple.png";
-        }
-    } else {
-        entity.sprites[DisplayType::TERMINAL] = " ";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/snake/floor.png";
-    }
-    entities[std::to_string(x) + "_" + std::to_string(y)] = entity;
-}
-
-void Snake::LoadSecondAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities)
-{
-    if (grid[y][x].isWall) {
-        setGridColor(entity, 255, 0, 0);
-        entity.sprites[DisplayType::TERMINAL] = "A";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_bomb.jpg";
-    } else if (grid[y][x].isSnake) {
-        setGridColor(entity, 0, 255, 255);
-        entity.sprites[DisplayType::TERMINAL] = "S";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_2.jpg";
-        if (snake.body.front().x == x && snake.body.front().y == y) {
-            setGridColor(entity, 255, 0, 255);
-            entity.sprites[DisplayType::TERMINAL] = "H";
-            switch (this->direction) {
-                case UP:
-                    entity.rotate = 180;
-                    break;
-                case DOWN:
-                    entity.rotate = 0;
-                    break;
-                case LEFT:
-                    entity.rotate = 90;
-                    break;
-                case RIGHT:
-                    entity.rotate = 270;
-                    break;
-            }
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_1.jpg";
-        }
-        if (gameOver) {
-            setGridColor(entity, 255, 0, 0);
-            entity.sprites[DisplayType::TERMINAL] = "X";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_4.jpg";
-            if (snake.body.front().x == x && snake.body.front().y == y) {
-                setGridColor(entity, 255, 0, 255);
-                entity.sprites[DisplayType::TERMINAL] = "H";
-                entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_3.jpg";
-            }
-        }
-    } else if (grid[y][x].isFood) {
-        setGridColor(entity, 0, 255, 0);
-        entity.sprites[DisplayType::TERMINAL] = "F";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_flag.jpg";
-        if (grid[y][x].isTempFood) {
-            setGridColor(entity, 255, 255, 0);
-            entity.sprites[DisplayType::TERMINAL] = "T";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_question.jpg";
-        }
-    } else {
-        entity.sprites[DisplayType::TERMINAL] = " ";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/Minesweeper_1/minesweeper_empty.jpg";
-    }
-    entities[std::to_string(x) + "_" + std::to_string(y)] = entity;
-}
-
-void Snake::LoadThirdAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities)
-{
-    if (grid[y][x].isWall) {
-        setGridColor(entity, 255, 0, 0);
-        entity.sprites[DisplayType::TERMINAL] = "A";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_bomb.jpg";
-    } else if (grid[y][x].isSnake) {
-        setGridColor(entity, 0, 255, 255);
-        entity.sprites[DisplayType::TERMINAL] = "S";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_2.jpg";
-        if (snake.body.front().x == x && snake.body.front().y == y) {
-            setGridColor(entity, 255, 0, 255);
-            entity.sprites[DisplayType::TERMINAL] = "H";
-            switch (this->direction) {
-                case UP:
-                    entity.rotate = 180;
-                    break;
-                case DOWN:
-                    entity.rotate = 0;
-                    break;
-                case LEFT:
-                    entity.rotate = 90;
-                    break;
-                case RIGHT:
-                    entity.rotate = 270;
-                    break;
-            }
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_1.jpg";
-        }
-        if (gameOver) {
-            setGridColor(entity, 255, 0, 0);
-            entity.sprites[DisplayType::TERMINAL] = "X";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_4.jpg";
-            if (snake.body.front().x == x && snake.body.front().y == y) {
-                setGridColor(entity, 255, 0, 255);
-                entity.sprites[DisplayType::TERMINAL] = "H";
-                entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_3.jpg";
-            }
-        }
-    } else if (grid[y][x].isFood) {
-        setGridColor(entity, 0, 255, 0);
-        entity.sprites[DisplayType::TERMINAL] = "F";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_flag.jpg";
-        if (grid[y][x].isTempFood) {
-            setGridColor(entity, 255, 255, 0);
-            entity.sprites[DisplayType::TERMINAL] = "T";
-            entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_question.jpg";
-        }
-    } else {
-        entity.sprites[DisplayType::TERMINAL] = " ";
-        entity.sprites[DisplayType::GRAPHICAL] = "assets/M_2/minesweeper_empty.jpg";
-    }
-    entities[std::to_string(x) + "_" + std::to_string(y)] = entity;
-}
-
 /**
  * @brief Updates the animation progress based on the game state.
  *
- * Calculates how far along we are in the animation between moves based on
- * the time since the last move and the current frame rate.
+ * Calculates how far along we are in the animation between moves from the
+ * fixed steps since the last move, plus the share of a step the core is
+ * past the last one, so the motion is smooth at any frame rate.
  */
 void Snake::updateAnimationProgress()
 {
-    auto currentTime = std::chrono::steady_clock::now();
-    _lastFrameTime = currentTime;
-
     if (_gameStart && !gameOver) {
-        int moveInterval = 1000 / _frameRate;
-        auto timeSinceLastMove = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - lastMoveTime).count();
-        _animationProgress = std::min(1.0f, static_cast<float>(timeSinceLastMove) / moveInterval);
+        double elapsed = _moveElapsed + _interpolation * _stepDuration;
+        _animationProgress = std::min(1.0f, static_cast<float>(elapsed * _frameRate));
     } else {
         _animationProgress = 0.0f;
     }
@@ -693,20 +632,51 @@ void Snake::updateAnimationProgress()
 /**
  * @brief Checks if the game should display the menu instead of gameplay.
  *
+ * When the game is lost, its last frame stays on screen for
+ * SNAKE_GAME_OVER_DELAY seconds before the menu. The delay is a timer of
+ * the game, so the core keeps running meanwhile.
+ *
  * @return true if the menu should be displayed, false otherwise
  */
 bool Snake::shouldShowMenu()
 {
-    if (gameOver && !_gameStart) {
-        std::this_thread::sleep_for(std::chrono::milliseconds(1000));
+    if (gameOver && _gameStart) {
+        _gameStart = false;
+        _isGameOverDelay = true;
+        _timers.schedule(_clock.now(), SNAKE_GAME_OVER_DELAY, [this]() {
+            _isGameOverDelay = false;
+        });
+        return false;
     }
-    if ((!_gameStart || gameOver) && !(_gameStart && gameOver)) {
-        return true;
+    if (_isGameOverDelay) {
+        return false;
     }
-    if (gameOver) {
-        _gameStart = false;
+    return !_gameStart || gameOver;
+}
+
+/**
+ * @brief Loads the asset packs of SNAKE_PACKS_DIR.
+ *
+ * Every manifest is read once here, the grid is then drawn by looking its
+ * cells up in the current pack. A pack that fails to load is reported and
+ * skipped, and when none loads the cells are drawn with blank sprites.
+ */
+void Snake::loadAssetPacks(void)
+{
+    const std::vector<std::string> kinds = SNAKE_SPRITE_KINDS;
+
+    _assetPacks.clear();
+    for (const std::string &path :
+        SpriteManifest::list(SNAKE_PACKS_DIR, SNAKE_PACK_EXTENSION)) {
+        SpriteManifest pack;
+        if (pack.load(path, kinds))
+            _assetPacks.push_back(std::move(pack));
     }
-    return false;
+    if (_assetPacks.empty()) {
+        std::cerr << "No asset pack in " << SNAKE_PACKS_DIR << std::endl;
+        _assetPacks.emplace_back(SPRITE_COUNT);
+    }
+    assetPack = 0;
 }
 
 /**
@@ -716,28 +686,26 @@ bool Snake::shouldShowMenu()
  */
 void Snake::renderGridElements(std::map<std::string, Entity>& entities)
 {
-    for (int y = 0; y < gridHeight; ++y) {
-        for (int x = 0; x < gridWidth; ++x) {
+    const SpriteManifest &pack = _assetPacks[assetPack];
+
+    for (int y = _view.y; y < _view.y + _view.rows; ++y) {
+        for (int x = _view.x; x < _view.x + _view.columns; ++x) {
             Entity entity;
             entity.type = Shape::RECTANGLE;
-            int offsetX = (1024 - (gridWidth * 38));
-            entity.x = x * 38 + offsetX;
-            entity.y = y * 38;
-            entity.width = 38;
-            entity.height = 38;
+            entity.x = (x - _view.x) * _view.cellSize + _view.offsetX;
+            entity.y = (y - _view.y) * _view.cellSize;
+            entity.width = _view.cellSize;
+            entity.height = _view.cellSize;
             entity.rotate = 0;
-            setGridColor(entity, 255, 255, 255);
-
-            bool isSnake = grid[y][x].isSnake;
-            grid[y][x].isSnake = false;
-            if (assetPack == 0) {
-                LoadFirstAssetPack(x, y, entity, entities);
-            } else if (assetPack == 1) {
-                LoadSecondAssetPack(x, y, entity, entities);
-            } else if (assetPack == 2) {
-                LoadThirdAssetPack(x, y, entity, entities);
-            }
-            grid[y][x].isSnake = isSnake;
+            if (grid.isWall.test(x, y))
+                pack[SPRITE_WALL].apply(entity);
+            else if (grid.isTempFood.test(x, y))
+                pack[SPRITE_TEMP_FOOD].apply(entity);
+            else if (grid.isFood.test(x, y))
+                pack[SPRITE_FOOD].apply(entity);
+            else
+                pack[SPRITE_FLOOR].apply(entity);
+            entities[std::to_string(x) + "_" + std::to_string(y)] = entity;
         }
     }
 }
@@ -766,8 +734,8 @@ void Snake::applySnakeAnimation(Entity& entity, size_t segmentIndex)
                 moveX = 1;
                 break;
         }
-        entity.x += static_cast<int>(moveX * 38 * _animationProgress);
-        entity.y += static_cast<int>(moveY * 38 * _animationProgress);
+        entity.x += static_cast<int>(moveX * _view.cellSize * _animationProgress);
+        entity.y += static_cast<int>(moveY * _view.cellSize * _animationProgress);
     } else {
         int x = snake.body[segmentIndex].x;
         int y = snake.body[segmentIndex].y;
@@ -777,8 +745,8 @@ void Snake::applySnakeAnimation(Entity& entity, size_t segmentIndex)
         if (moveX < -1) moveX = 1;
         if (moveY > 1) moveY = -1;
         if (moveY < -1) moveY = 1;
-        entity.x += static_cast<int>(moveX * 38 * _animationProgress);
-        entity.y += static_cast<int>(moveY * 38 * _animationProgress);
+        entity.x += static_cast<int>(moveX * _view.cellSize * _animationProgress);
+        entity.y += static_cast<int>(moveY * _view.cellSize * _animationProgress);
     }
 }
 
@@ -790,38 +758,26 @@ void Snake::applySnakeAnimation(Entity& entity, size_t segmentIndex)
  */
 void Snake::configureSnakeSegment(Entity& entity, bool isHead)
 {
+    const SpriteManifest &pack = _assetPacks[assetPack];
+
     if (isHead) {
-        setGridColor(entity, 255, 0, 255);
-        entity.sprites[DisplayType::TERMINAL] = "H";
+        pack[gameOver ? SPRITE_DEAD_HEAD : SPRITE_HEAD].apply(entity);
         switch (direction) {
             case UP:    entity.rotate = 180; break;
             case DOWN:  entity.rotate = 0; break;
             case LEFT:  entity.rotate = 90; break;
             case RIGHT: entity.rotate = 270; break;
         }
-        if (assetPack == 0) {
-            entity.sprites[DisplayType::GRAPHICAL] = gameOver ?
-                "assets/snake/dead_head.png" : "assets/snake/head.png";
-        } else {
-            entity.sprites[DisplayType::GRAPHICAL] = gameOver ?
-                "assets/Minesweeper_1/minesweeper_3.jpg" : "assets/Minesweeper_1/minesweeper_1.jpg";
-        }
     } else {
-        setGridColor(entity, 0, 255, 255);
-        entity.sprites[DisplayType::TERMINAL] = "S";
-        if (assetPack == 0) {
-            entity.sprites[DisplayType::GRAPHICAL] = gameOver ?
-                "assets/snake/dead_snake.png" : "assets/snake/snake.png";
-        } else {
-            entity.sprites[DisplayType::GRAPHICAL] = gameOver ?
-                "assets/Minesweeper_1/minesweeper_4.jpg" : "assets/Minesweeper_1/minesweeper_2.jpg";
-        }
+        pack[gameOver ? SPRITE_DEAD_BODY : SPRITE_BODY].apply(entity);
     }
 }
 
 /**
  * @brief Renders the snake with animation effects.
  *
+ * Only the segments in the viewport are rendered.
+ *
  * @param entities The map of entities to which snake elements will be added.
  */
 void Snake::renderSnake(std::map<std::string, Entity>& entities)
@@ -831,23 +787,62 @@ void Snake::renderSnake(std::map<std::string, Entity>& entities)
         int y = snake.body[i].y;
         bool isHead = (i == 0);
 
+        if (!isInViewport(x, y))
+            continue;
         Entity entity;
         entity.type = Shape::RECTANGLE;
-        int offsetX = (1024 - (gridWidth * 38));
-        entity.x = x * 38 + offsetX;
-        entity.y = y * 38;
-        entity.width = 38;
-        entity.height = 38;
+        entity.x = (x - _view.x) * _view.cellSize + _view.offsetX;
+        entity.y = (y - _view.y) * _view.cellSize;
+        entity.width = _view.cellSize;
+        entity.height = _view.cellSize;
         entity.rotate = 0;
         if (_gameStart && !gameOver) {
             applySnakeAnimation(entity, i);
         }
-        grid[y][x].isSnake = true;
         configureSnakeSegment(entity, isHead);
         entities["snake_" + std::to_string(i)] = entity;
     }
 }
 
+/**
+ * @brief Moves the viewport over the head of the snake.
+ *
+ * The cell size is the largest of SNAKE_CELL_SIZES that fits the whole
+ * grid in the view. When even the smallest does not, the view is centered
+ * on the head and clamped to the edges of the grid.
+ */
+void Snake::updateViewport(void)
+{
+    static const int cellSizes[] = SNAKE_CELL_SIZES;
+    const Position &head = snake.body.front();
+
+    _view.cellSize = cellSizes[std::size(cellSizes) - 1];
+    for (int size : cellSizes) {
+        if (std::max(gridWidth, gridHeight) * size <= SNAKE_VIEW_SIZE) {
+            _view.cellSize = size;
+            break;
+        }
+    }
+    _view.columns = std::min(gridWidth, SNAKE_VIEW_SIZE / _view.cellSize);
+    _view.rows = std::min(gridHeight, SNAKE_VIEW_SIZE / _view.cellSize);
+    _view.x = std::clamp(head.x - _view.columns / 2, 0, gridWidth - _view.columns);
+    _view.y = std::clamp(head.y - _view.rows / 2, 0, gridHeight - _view.rows);
+    _view.offsetX = 1024 - _view.columns * _view.cellSize;
+}
+
+/**
+ * @brief Checks if a cell is drawn in the current viewport.
+ *
+ * @param x The x-coordinate of the cell.
+ * @param y The y-coordinate of the cell.
+ * @return true if the cell is visible.
+ */
+bool Snake::isInViewport(int x, int y) const
+{
+    return x >= _view.x && x < _view.x + _view.columns &&
+        y >= _view.y && y < _view.y + _view.rows;
+}
+
 /**
  * @brief Renders the game grid and returns the entities to display.
  *
@@ -861,9 +856,6 @@ void Snake::renderSnake(std::map<std::string, Entity>& entities)
 std::map<std::string, Entity> Snake::renderGame()
 {
     std::map<std::string, Entity> entities;
-    static auto playStartTime = std::chrono::steady_clock::now();
-    static bool clockRunning = false;
-
 
     entities.clear();
     updateAnimationProgress();
@@ -871,20 +863,18 @@ std::map<std::string, Entity> Snake::renderGame()
         _sounds.push_back("assets/gameover.mp3");
     }
     if (_gameStart) {
-        if (!clockRunning) {
-            playStartTime = std::chrono::steady_clock::now();
-            clockRunning = true;
+        if (!_isClockRunning) {
+            _playStartTime = _clock.now();
+            _isClockRunning = true;
         } else {
-            auto currentTime = std::chrono::steady_clock::now();
-            _PlayTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - playStartTime).count();
+            auto currentTime = _clock.now();
+            _PlayTime = std::chrono::duration_cast<std::chrono::seconds>(currentTime - _playStartTime).count();
         }
-    } else {
-        clockRunning = false;
-        _PlayTime = 0;
     }
     if (shouldShowMenu()) {
         return domenu();
     }
+    updateViewport();
     renderGridElements(entities);
     std::string scoreString = "Score: " + std::to_string((int)_score.first);
     entities["Score_display"] = createTextEntity(scoreString, 20, 10, 20, 20, 255, 255, 255);
@@ -931,6 +921,7 @@ void Snake::handleMenuEvent(std::vector<RawEvent> events)
                     _sounds.push_back("assets/music_snake_rock.mp3");
                     _gameStart = true;
                     _score.second = _playerName;
+                    resetTimers();
                 }
                 else if (event.x >= 1024 / 2 - 50 && event.x <= 1024 / 2 - 50 + 60  + 200 &&
                          event.y >= 768 / 2 + 75 && event.y <= 768 / 2 + 75 + 30 + 50) {
@@ -952,26 +943,22 @@ void Snake::handleMenuEvent(std::vector<RawEvent> events)
  * @brief Resets the game grid and state.
  *
  * This function resets the game grid and state to their initial values.
- * It clears the grid, resets the snake's body, and sets the direction
- * to UP.
+ * It clears the grid, resets the snake's body, sets the direction
+ * to UP and stops the play time clock. The play time is kept until then,
+ * so the board of a lost game still shows it during the game over delay.
  */
 void Snake::resetGrid()
 {
-    for (int y = 0; y < gridHeight; ++y) {
-        for (int x = 0; x < gridWidth; ++x) {
-            grid[y][x].isWall = false;
-            grid[y][x].isSnake = false;
-            grid[y][x].isFood = false;
-            grid[y][x].isTimeFood = false;
-        }
-    }
     snake.body.clear();
     direction = UP;
+    _turns.clear();
     _score.first = 0;
     _score.second = "\0";
     _fruitEat = 0;
     _specialFruitEat = 0;
     _specialFruitSpawn = 0;
+    _isClockRunning = false;
+    _PlayTime = 0;
     setFrameRate(false, false, true);
     createGrid(gridWidth, gridHeight);
 }
@@ -1140,12 +1127,10 @@ void Snake::addBackgroundEntity(std::map<std::string, Entity>& entities)
  */
 void Snake::typeName(std::vector<RawEvent> events)
 {
-    static bool shiftActive = false;
-
     for (const auto& event : events) {
         if (event.type == EventType::PRESS) {
             if (event.key == KEYBOARD_LSHIFT || event.key == KEYBOARD_RSHIFT) {
-                shiftActive = true;
+                _isShiftActive = true;
             }
             if (event.key == KEYBOARD_BACKSPACE) {
                 if (!_playerName.empty()) {
@@ -1159,7 +1144,7 @@ void Snake::typeName(std::vector<RawEvent> events)
                 _sounds.push_back("assets/menu/keyboard-click4.ogg");
                 if (event.key >= KEYBOARD_A && event.key <= KEYBOARD_Z) {
                     char letter;
-                    if (shiftActive) {
+                    if (_isShiftActive) {
                         letter = 'A' + (event.key - KEYBOARD_A);
                     } else {
                         letter = 'a' + (event.key - KEYBOARD_A);
@@ -1167,7 +1152,7 @@ void Snake::typeName(std::vector<RawEvent> events)
                     if (_playerName.size() < 8) {
                         _playerName += letter;
                     }
-                    int randomNum = rand() % 3;
+                    int randomNum = _random.below(3);
                     if (randomNum == 0) {
                         _sounds.push_back("assets/menu/keyboard-click1.ogg");
                     } else if (randomNum == 1) {
@@ -1178,7 +1163,7 @@ void Snake::typeName(std::vector<RawEvent> events)
                 }
             }
         } else if (event.type == EventType::RELEASE && (event.key == KEYBOARD_LSHIFT || event.key == KEYBOARD_RSHIFT)) {
-            shiftActive = false;
+            _isShiftActive = false;
         }
     }
 }
@@ -1200,6 +1185,7 @@ std::map<std::string, Entity> Snake::domenu()
         _gameStart = false;
     }
     gameOver = false;
+    _isGameOverReported = false;
     resetGrid();
 
     addBackgroundEntity(entities);
@@ -1240,6 +1226,17 @@ void Snake::setUsername(std::string username)
     _playerName = username;
 }
 
+/**
+ * @brief Sets the seed of the random generator of the game.
+ *
+ * @param seed The seed, the same seed gives the same food placements.
+ */
+void Snake::setSeed(std::uint64_t seed)
+{
+    _random.setSeed(seed);
+    _nextTempFoodInterval = _random.range(15, 25);
+}
+
 /**
  * @brief Get the new display
  *
@@ -12,31 +12,109 @@
     #include <map>
     #include <vector>
     #include "../interfaces/IGame.hpp"
+    #include "../utils/BitGrid.hpp"
+    #include "../utils/GameClock.hpp"
+    #include "../utils/IndexSet.hpp"
+    #include "../utils/Random.hpp"
+    #include "../utils/RingBuffer.hpp"
+    #include "../utils/SpriteManifest.hpp"
+    #include "../utils/TimerQueue.hpp"
     #include <chrono>
-    #include <queue>
+    #include <cstdint>
 
     #define LIBRARY_NAME "Snake"
 
+    // Initial length of the snake, used by the benchmarks
+    #define SNAKE_LENGTH_ENV "ARCADE_SNAKE_LENGTH"
+    #define SNAKE_DEFAULT_LENGTH 4
+
+    // Size of the grid, "<width>x<height>", used by the benchmarks
+    #define SNAKE_GRID_ENV "ARCADE_SNAKE_GRID"
+    #define SNAKE_DEFAULT_GRID 20
+    #define SNAKE_MIN_GRID 10
+    #define SNAKE_MAX_GRID 512
+
+    // Side of the square the grid is drawn in, on the right of the screen
+    #define SNAKE_VIEW_SIZE 760
+    // Cell sizes from the most to the least detailed, the first one that
+    // fits the whole grid is used, else the last one and the view scrolls
+    #define SNAKE_CELL_SIZES {38, 19, 10}
+
+    // Time the last frame of a lost game stays on screen, in seconds
+    #define SNAKE_GAME_OVER_DELAY 1.0
+
+    // Turns kept ahead of the moves, one is applied per move
+    #define SNAKE_TURN_BUFFER 3
+
+    // Asset packs, cycled with F1 and F2 in the order of their file names
+    #define SNAKE_PACKS_DIR "assets/snake/packs"
+    #define SNAKE_PACK_EXTENSION ".pack"
+    #define SNAKE_SPRITE_KINDS {"wall", "floor", "food", "temp_food", \
+        "body", "head", "dead_body", "dead_head"}
+
+// Kinds of the sprites of an asset pack, in the order of SNAKE_SPRITE_KINDS
+enum SnakeSprite {
+    SPRITE_WALL,
+    SPRITE_FLOOR,
+    SPRITE_FOOD,
+    SPRITE_TEMP_FOOD,
+    SPRITE_BODY,
+    SPRITE_HEAD,
+    SPRITE_DEAD_BODY,
+    SPRITE_DEAD_HEAD,
+    SPRITE_COUNT
+};
+
 struct Position {
     int x = 0;
     int y = 0;
 };
 
-struct Cell {
-    bool isSnake = false;
-    bool isFood = false;
-    bool isTimeFood = false;
-    bool isWall = false;
-    bool isTempFood = false;
-    struct Position pos;
+/**
+ * @brief Flags of the grid cells, one bitplane per flag
+ *
+ * The free cells and the food are also kept as sets of cell indexes,
+ * updated on every move and meal, so that food is spawned and found
+ * without scanning the grid.
+ */
+struct Grid {
+    BitGrid isSnake;
+    BitGrid isFood;
+    BitGrid isTimeFood;
+    BitGrid isWall;
+    BitGrid isTempFood;
+    IndexSet freeCells;
+    IndexSet food;
+    int tempFood = -1;
 };
 
+/**
+ * @brief The snake, its body runs from the head to the tail
+ *
+ * The body is a ring buffer sized to the grid, so moving pushes the head
+ * and pops the tail without shifting the segments in between.
+ */
 struct snake {
-    std::vector<Position> body;
+    RingBuffer<Position> body;
     bool isAlive = true;
     int length = 4;
 };
 
+/**
+ * @brief The part of the grid drawn this frame
+ *
+ * It follows the head when the grid does not fit the view, and only the
+ * cells it covers are turned into entities.
+ */
+struct Viewport {
+    int x = 0;
+    int y = 0;
+    int columns = 0;
+    int rows = 0;
+    int cellSize = 38;
+    int offsetX = 0;
+};
+
 enum Direction {
     UP,
     DOWN,
@@ -44,6 +122,14 @@ enum Direction {
     RIGHT
 };
 
+/**
+ * @brief A direction pressed by the player and the time of the press
+ */
+struct Turn {
+    Direction direction;
+    std::uint64_t timestamp;
+};
+
 class Snake : public IGame {
     public:
         Snake();
@@ -56,12 +142,16 @@ class Snake : public IGame {
         std::string getNewLib(void) override;
 
         void handleEvent(std::vector<RawEvent>) override;
+        void update(double dt) override;
+        void fixedUpdate(double dt) override;
+        void setInterpolation(double alpha) override;
         std::map<std::string, Entity> renderGame() override;
 
         std::string getNewDisplay(void) override;
 
         std::string getName(void) override;
         void setUsername(std::string username) final;
+        void setSeed(std::uint64_t seed) final;
 
     protected:
     private:
@@ -72,16 +162,19 @@ class Snake : public IGame {
         void moveSnake();
         void generateFood(bool timeFood, bool isTempFood);
         void eatFood();
+        void removeFood(int index);
         void createGrid(int width, int height);
-        void setGridColor(Entity& entity, int r, int g, int b);
-        void LoadFirstAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities);
-        void LoadSecondAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities);
-        void LoadThirdAssetPack(int x, int y, Entity& entity, std::map<std::string, Entity>& entities);
+        void loadGridFromEnv(void);
+        void updateViewport(void);
+        bool isInViewport(int x, int y) const;
+        void placeSnake(int width, int height);
+        void loadAssetPacks(void);
         bool shouldSpawnFruit();
-        bool shouldMoveSnake();
         void shouldIncreaseSpeed();
         void setDirection(std::vector<RawEvent> events);
+        void queueTurn(const Turn &turn);
         void setFrameRate(bool speed, bool up, bool reset);
+        void resetTimers();
         std::map<std::string, Entity> domenu();
         void handleMenuEvent(std::vector<RawEvent> events);
         void resetGrid();
@@ -108,29 +201,52 @@ class Snake : public IGame {
         void handleTempFood();
 
 
-        std::vector<std::vector<Cell>> grid;
+        Grid grid;
         std::pair<float, std::string> _score;
         std::vector<std::string> _sounds;
         bool gameOver = false;
+        // Set once isGameOver reported the lost game to the core
+        bool _isGameOverReported = false;
         bool gameEnd = false;
         bool _win;
-        const int gridWidth = 20;
-        const int gridHeight = 20;
+        int gridWidth = SNAKE_DEFAULT_GRID;
+        int gridHeight = SNAKE_DEFAULT_GRID;
+        Viewport _view;
         enum Direction direction;
         struct snake snake;
-        std::chrono::steady_clock::time_point lastMoveTime;
         int _frameRate = 1;
         bool _gameStart = false;
-        int assetPack = 0;
+        std::vector<SpriteManifest> _assetPacks;
+        std::size_t assetPack = 0;
         float _animationProgress = 0.0f;
-        std::chrono::steady_clock::time_point _lastFrameTime;
+        // Time since the last move, counted in fixed steps
+        double _moveElapsed = 0;
+        double _stepDuration = 0;
+        double _interpolation = 0;
         std::string _playerName = "YOUR NAME";
         bool _typeName = false;
-        std::queue<RawEvent> _bufferedEvents;
+        RingBuffer<Turn> _turns;
+        std::vector<Turn> _frameTurns;
         int _fruitEat = 0;
         int _specialFruitEat = 0;
         int _specialFruitSpawn = 0;
         size_t _PlayTime = 0;
+        Random _random;
+        int _nextTempFoodInterval = 15;
+
+        // Timers of the game, read from its own clock
+        GameClock _clock;
+        int _previousFrameRate = 10;
+        std::chrono::steady_clock::time_point _lastSpeedIncreaseTime;
+        std::chrono::steady_clock::time_point _lastFruitSpawnTime;
+        std::chrono::steady_clock::time_point _lastTempFoodSpawnTime;
+        std::chrono::steady_clock::time_point _tempFoodPlacedTime;
+        bool _isTempFoodActive = false;
+        std::chrono::steady_clock::time_point _playStartTime;
+        bool _isClockRunning = false;
+        bool _isShiftActive = false;
+        TimerQueue _timers;
+        bool _isGameOverDelay = false;
 };
 
 #endif /* !SNAKE_HPP_ */
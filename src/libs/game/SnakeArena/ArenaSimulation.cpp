@@ -0,0 +1,309 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** ArenaSimulation
+*/
+
+#include "ArenaSimulation.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Build an empty arena, then spawn the snakes and the food
+ *
+ * @param config The size of the arena, its snakes, threads and seed
+ */
+ArenaSimulation::ArenaSimulation(const ArenaConfig &config)
+    : _width(config.width), _height(config.height),
+    _claims(config.width * config.height, 0),
+    _free(config.width * config.height), _food(config.width * config.height),
+    _snakes(config.snakes), _random(config.seed), _jobs(config.threads),
+    _searches(_jobs.getThreadCount())
+{
+    int cells = _width * _height;
+
+    for (int cell = 0; cell < cells; cell++)
+        _free.insert(cell);
+    for (Search &search : _searches) {
+        search.stamps.assign(cells, 0);
+        search.parents.assign(cells, -1);
+        search.queue.reserve(cells);
+    }
+    for (ArenaSnake &snake : _snakes) {
+        snake.body.reset(cells);
+        spawnSnake(snake);
+    }
+    spawnFood();
+}
+
+////////////////////////////////// Simulation /////////////////////////////////
+
+/**
+ * @brief Advance the arena by one step
+ *
+ * The plans are computed in parallel from the state of the previous tick.
+ * Two snakes planning the same cell both die, as does a snake with no
+ * free cell around its head. The dead snakes are respawned at once.
+ */
+void ArenaSimulation::tick(void)
+{
+    _jobs.parallelFor(_snakes.size(), 1,
+        [this](std::size_t begin, std::size_t end, std::size_t thread) {
+            for (std::size_t i = begin; i < end; i++)
+                plan(_snakes[i], _searches[thread]);
+        });
+    for (const ArenaSnake &snake : _snakes) {
+        if (snake.target >= 0 && _claims[snake.target] < 2)
+            _claims[snake.target]++;
+    }
+    for (ArenaSnake &snake : _snakes) {
+        if (!snake.isAlive)
+            continue;
+        if (snake.target < 0 || _claims[snake.target] > 1)
+            kill(snake);
+        else
+            move(snake);
+    }
+    for (ArenaSnake &snake : _snakes) {
+        if (snake.target >= 0)
+            _claims[snake.target] = 0;
+        if (!snake.isAlive)
+            spawnSnake(snake);
+    }
+    spawnFood();
+    _ticks++;
+}
+
+/**
+ * @brief Choose the next cell of a snake
+ *
+ * The snake heads to the closest food it can reach. When it can reach
+ * none it takes the first free cell around its head, in the order of
+ * neighbour().
+ *
+ * @param snake The snake to plan for
+ * @param search The search memory of the running thread
+ */
+void ArenaSimulation::plan(ArenaSnake &snake, Search &search) const
+{
+    int head;
+
+    snake.target = -1;
+    if (!snake.isAlive)
+        return;
+    head = snake.body.front();
+    snake.target = findFood(head, search);
+    for (int direction = 0; direction < 4 && snake.target < 0; direction++) {
+        int cell = neighbour(head, direction);
+        if (cell >= 0 && !isBlocked(cell))
+            snake.target = cell;
+    }
+}
+
+/**
+ * @brief Breadth-first search from a head to the closest food
+ *
+ * The bodies of all the snakes, their tails included, are obstacles.
+ *
+ * @param head The cell of the head
+ * @param search The search memory of the running thread
+ * @return int The first cell of the path, -1 if no food is reachable
+ */
+int ArenaSimulation::findFood(int head, Search &search) const
+{
+    if (++search.stamp == 0) {
+        std::fill(search.stamps.begin(), search.stamps.end(), 0);
+        search.stamp = 1;
+    }
+    search.queue.clear();
+    search.queue.push_back(head);
+    search.stamps[head] = search.stamp;
+    for (std::size_t i = 0; i < search.queue.size(); i++) {
+        int cell = search.queue[i];
+        for (int direction = 0; direction < 4; direction++) {
+            int next = neighbour(cell, direction);
+            if (next < 0 || search.stamps[next] == search.stamp)
+                continue;
+            search.stamps[next] = search.stamp;
+            search.parents[next] = cell;
+            if (_food.contains(next)) {
+                while (search.parents[next] != head)
+                    next = search.parents[next];
+                return next;
+            }
+            if (_free.contains(next))
+                search.queue.push_back(next);
+        }
+    }
+    return -1;
+}
+
+/**
+ * @brief Get a neighbour of a cell
+ *
+ * @param cell The cell
+ * @param direction 0 for up, 1 for down, 2 for left, 3 for right
+ * @return int The neighbour, -1 past the edges of the arena
+ */
+int ArenaSimulation::neighbour(int cell, int direction) const
+{
+    int x = cell % _width;
+    int y = cell / _width;
+
+    switch (direction) {
+        case 0:
+            return y > 0 ? cell - _width : -1;
+        case 1:
+            return y < _height - 1 ? cell + _width : -1;
+        case 2:
+            return x > 0 ? cell - 1 : -1;
+        default:
+            return x < _width - 1 ? cell + 1 : -1;
+    }
+}
+
+/**
+ * @brief Check if a cell holds a snake
+ *
+ * @param cell The cell
+ * @return true if the cell is neither free nor food
+ */
+bool ArenaSimulation::isBlocked(int cell) const
+{
+    return !_free.contains(cell) && !_food.contains(cell);
+}
+
+/**
+ * @brief Move a snake to its planned cell, eating the food there
+ *
+ * @param snake The snake to move
+ */
+void ArenaSimulation::move(ArenaSnake &snake)
+{
+    if (_food.contains(snake.target)) {
+        _food.erase(snake.target);
+        snake.grow++;
+    } else {
+        _free.erase(snake.target);
+    }
+    snake.body.pushFront(snake.target);
+    if (snake.grow > 0) {
+        snake.grow--;
+        return;
+    }
+    _free.insert(snake.body.back());
+    snake.body.popBack();
+}
+
+/**
+ * @brief Remove a snake from the arena, its cells are freed
+ *
+ * @param snake The snake to kill
+ */
+void ArenaSimulation::kill(ArenaSnake &snake)
+{
+    for (std::size_t i = 0; i < snake.body.size(); i++)
+        _free.insert(snake.body[i]);
+    snake.body.clear();
+    snake.isAlive = false;
+    _deaths++;
+}
+
+/**
+ * @brief Put a snake on a random free cell, it grows to its start length
+ * in the next ticks
+ *
+ * @param snake The snake to spawn
+ */
+void ArenaSimulation::spawnSnake(ArenaSnake &snake)
+{
+    int cell;
+
+    if (_free.empty())
+        return;
+    cell = _free[_random.below(_free.size())];
+    _free.erase(cell);
+    snake.body.pushFront(cell);
+    snake.grow = ARENA_START_LENGTH - 1;
+    snake.isAlive = true;
+}
+
+/**
+ * @brief Drop food on random free cells up to ARENA_FOOD_PER_SNAKE per
+ * snake
+ */
+void ArenaSimulation::spawnFood(void)
+{
+    std::size_t count = _snakes.size() * ARENA_FOOD_PER_SNAKE;
+
+    while (_food.size() < count && !_free.empty()) {
+        int cell = _free[_random.below(_free.size())];
+        _free.erase(cell);
+        _food.insert(cell);
+    }
+}
+
+/////////////////////////////////// Getters ///////////////////////////////////
+
+int ArenaSimulation::getWidth(void) const
+{
+    return _width;
+}
+
+int ArenaSimulation::getHeight(void) const
+{
+    return _height;
+}
+
+const std::vector<ArenaSnake> &ArenaSimulation::getSnakes(void) const
+{
+    return _snakes;
+}
+
+const IndexSet &ArenaSimulation::getFood(void) const
+{
+    return _food;
+}
+
+std::uint64_t ArenaSimulation::getTicks(void) const
+{
+    return _ticks;
+}
+
+std::uint64_t ArenaSimulation::getDeaths(void) const
+{
+    return _deaths;
+}
+
+std::size_t ArenaSimulation::getThreadCount(void) const
+{
+    return _jobs.getThreadCount();
+}
+
+/**
+ * @brief Hash the state of the arena
+ *
+ * Two runs with the same configuration and seed give the same checksum
+ * after the same number of ticks, whatever their number of threads.
+ *
+ * @return std::uint64_t The FNV-1a hash of the snakes and the food
+ */
+std::uint64_t ArenaSimulation::getChecksum(void) const
+{
+    std::uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&hash](std::uint64_t value) {
+        hash = (hash ^ value) * 0x100000001b3ULL;
+    };
+
+    mix(_ticks);
+    mix(_deaths);
+    for (const ArenaSnake &snake : _snakes) {
+        mix(snake.body.size());
+        for (std::size_t i = 0; i < snake.body.size(); i++)
+            mix(snake.body[i]);
+    }
+    for (int cell : _food)
+        mix(cell);
+    return hash;
+}
@@ -0,0 +1,104 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** ArenaSimulation
+*/
+
+#ifndef ARENASIMULATION_HPP_
+    #define ARENASIMULATION_HPP_
+
+    #include <cstdint>
+    #include <vector>
+    #include "JobSystem.hpp"
+    #include "../utils/IndexSet.hpp"
+    #include "../utils/Random.hpp"
+    #include "../utils/RingBuffer.hpp"
+
+    #define ARENA_START_LENGTH 4
+    #define ARENA_FOOD_PER_SNAKE 2
+
+/**
+ * @brief Size of an arena and how to simulate it
+ */
+struct ArenaConfig {
+    int width = 128;
+    int height = 128;
+    int snakes = 32;
+    std::size_t threads = 1;
+    std::uint64_t seed = RANDOM_DEFAULT_SEED;
+};
+
+/**
+ * @brief A snake of the arena, its body holds cell indexes from the head
+ */
+struct ArenaSnake {
+    RingBuffer<int> body;
+    int grow = 0;
+    int target = -1;
+    bool isAlive = false;
+};
+
+/**
+ * @brief Snakes driven by a breadth-first search toward the food
+ *
+ * A tick runs in two phases. The snakes first plan their next cell in
+ * parallel, each one searching the grid as it was at the start of the
+ * tick and writing only its own plan. The moves are then applied in the
+ * order of the snakes on a single thread, along with the collisions, the
+ * respawns and the food. The result only depends on the seed, not on the
+ * number of threads.
+ */
+class ArenaSimulation {
+    public:
+        explicit ArenaSimulation(const ArenaConfig &config);
+        ~ArenaSimulation() = default;
+
+        void tick(void);
+
+        int getWidth(void) const;
+        int getHeight(void) const;
+        const std::vector<ArenaSnake> &getSnakes(void) const;
+        const IndexSet &getFood(void) const;
+        std::uint64_t getTicks(void) const;
+        std::uint64_t getDeaths(void) const;
+        std::size_t getThreadCount(void) const;
+        std::uint64_t getChecksum(void) const;
+
+    private:
+        /**
+         * @brief Memory of the searches run by one thread
+         *
+         * A cell is visited by the current search when its stamp matches,
+         * so the arrays are never cleared between searches.
+         */
+        struct Search {
+            std::vector<std::uint32_t> stamps;
+            std::vector<int> parents;
+            std::vector<int> queue;
+            std::uint32_t stamp = 0;
+        };
+
+        void plan(ArenaSnake &snake, Search &search) const;
+        int findFood(int head, Search &search) const;
+        int neighbour(int cell, int direction) const;
+        bool isBlocked(int cell) const;
+        void move(ArenaSnake &snake);
+        void kill(ArenaSnake &snake);
+        void spawnSnake(ArenaSnake &snake);
+        void spawnFood(void);
+
+        int _width;
+        int _height;
+        std::vector<std::uint8_t> _claims;
+        IndexSet _free;
+        IndexSet _food;
+        std::vector<ArenaSnake> _snakes;
+        Random _random;
+        JobSystem _jobs;
+        std::vector<Search> _searches;
+        std::uint64_t _ticks = 0;
+        std::uint64_t _deaths = 0;
+};
+
+#endif /* !ARENASIMULATION_HPP_ */
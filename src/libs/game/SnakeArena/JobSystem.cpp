@@ -0,0 +1,124 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** JobSystem
+*/
+
+#include "JobSystem.hpp"
+
+#include <algorithm>
+
+/**
+ * @brief Start the workers, the calling thread counts as one of them
+ *
+ * @param threads The number of threads running the loops, at least 1
+ */
+JobSystem::JobSystem(std::size_t threads)
+{
+    threads = std::max<std::size_t>(threads, 1);
+    for (std::size_t thread = 1; thread < threads; thread++)
+        _workers.emplace_back(&JobSystem::work, this, thread);
+}
+
+/**
+ * @brief Stop and join the workers
+ */
+JobSystem::~JobSystem()
+{
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _stopping = true;
+    }
+    _wake.notify_all();
+    for (std::thread &worker : _workers)
+        worker.join();
+}
+
+/**
+ * @brief Get the number of threads running the loops
+ *
+ * @return std::size_t The workers and the calling thread
+ */
+std::size_t JobSystem::getThreadCount(void) const
+{
+    return _workers.size() + 1;
+}
+
+/**
+ * @brief Run a job over [0, count) and wait for it
+ *
+ * The range is cut into chunks of a given size, handed out in order to
+ * the threads as they become free. A range of a single chunk is run on the
+ * calling thread without waking the workers.
+ *
+ * @param count The size of the range
+ * @param chunk The number of items per chunk
+ * @param job The function run on each chunk
+ */
+void JobSystem::parallelFor(std::size_t count, std::size_t chunk,
+    const Job &job)
+{
+    chunk = std::max<std::size_t>(chunk, 1);
+    if (count == 0)
+        return;
+    if (_workers.empty() || count <= chunk) {
+        job(0, count, 0);
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _job = &job;
+        _count = count;
+        _chunk = chunk;
+        _next = 0;
+        _busy = _workers.size();
+        _generation++;
+    }
+    _wake.notify_all();
+    runChunks(0);
+    std::unique_lock<std::mutex> lock(_mutex);
+    _done.wait(lock, [this]() { return _busy == 0; });
+    _job = nullptr;
+}
+
+/**
+ * @brief Loop of a worker: wait for a job, help with it, report
+ *
+ * @param thread The index of the worker
+ */
+void JobSystem::work(std::size_t thread)
+{
+    std::size_t generation = 0;
+
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _wake.wait(lock, [this, generation]() {
+                return _stopping || _generation != generation;
+            });
+            if (_stopping)
+                return;
+            generation = _generation;
+        }
+        runChunks(thread);
+        std::lock_guard<std::mutex> lock(_mutex);
+        if (--_busy == 0)
+            _done.notify_one();
+    }
+}
+
+/**
+ * @brief Take and run chunks of the current job until none is left
+ *
+ * @param thread The index of the running thread
+ */
+void JobSystem::runChunks(std::size_t thread)
+{
+    while (true) {
+        std::size_t begin = _next.fetch_add(_chunk);
+        if (begin >= _count)
+            return;
+        (*_job)(begin, std::min(begin + _chunk, _count), thread);
+    }
+}
@@ -0,0 +1,59 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** JobSystem
+*/
+
+#ifndef JOBSYSTEM_HPP_
+    #define JOBSYSTEM_HPP_
+
+    #include <atomic>
+    #include <condition_variable>
+    #include <cstddef>
+    #include <functional>
+    #include <mutex>
+    #include <thread>
+    #include <vector>
+
+/**
+ * @brief Fixed pool of worker threads running parallel loops
+ *
+ * parallelFor cuts a range into chunks that the workers and the calling
+ * thread take in turn, then returns once all of them are done. Each chunk
+ * is given the index of the thread that runs it, below getThreadCount(),
+ * so that jobs can keep scratch memory per thread without locking. Jobs
+ * must not throw.
+ */
+class JobSystem {
+    public:
+        using Job = std::function<void(std::size_t begin, std::size_t end,
+            std::size_t thread)>;
+
+        explicit JobSystem(std::size_t threads);
+        ~JobSystem();
+
+        JobSystem(const JobSystem &) = delete;
+        JobSystem &operator=(const JobSystem &) = delete;
+
+        std::size_t getThreadCount(void) const;
+        void parallelFor(std::size_t count, std::size_t chunk, const Job &job);
+
+    private:
+        void work(std::size_t thread);
+        void runChunks(std::size_t thread);
+
+        std::vector<std::thread> _workers;
+        std::mutex _mutex;
+        std::condition_variable _wake;
+        std::condition_variable _done;
+        const Job *_job = nullptr;
+        std::size_t _count = 0;
+        std::size_t _chunk = 1;
+        std::atomic<std::size_t> _next{0};
+        std::size_t _busy = 0;
+        std::size_t _generation = 0;
+        bool _stopping = false;
+};
+
+#endif /* !JOBSYSTEM_HPP_ */
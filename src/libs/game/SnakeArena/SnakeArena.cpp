@@ -0,0 +1,398 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** SnakeArena
+*/
+
+#include "SnakeArena.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <thread>
+
+static const int SNAKE_COLORS[][3] = {
+    {0, 255, 255}, {255, 0, 255}, {255, 255, 0},
+    {0, 128, 255}, {255, 128, 0}, {128, 255, 128}
+};
+
+SnakeArena::SnakeArena()
+    : _config(loadConfigFromEnv()),
+    _simulation(std::make_unique<ArenaSimulation>(_config))
+{
+    _cellSize = std::max(1, ARENA_VIEW_SIZE /
+        std::max(_config.width, _config.height));
+    _offsetX = 1024 - _config.width * _cellSize;
+    _rateStart = std::chrono::steady_clock::now();
+}
+
+SnakeArena::~SnakeArena()
+{
+}
+
+/**
+ * @brief Reads the arena from the environment.
+ *
+ * ARCADE_ARENA_GRID holds "<width>x<height>", each side at most
+ * ARENA_MAX_GRID so that the arena fits its view, ARCADE_ARENA_SNAKES and
+ * ARCADE_ARENA_THREADS hold numbers. An invalid value is reported and the
+ * default is kept.
+ *
+ * @return ArenaConfig The configuration of the arena.
+ */
+ArenaConfig SnakeArena::loadConfigFromEnv(void)
+{
+    ArenaConfig config;
+    const char *grid = std::getenv(ARENA_GRID_ENV);
+    const char *snakes = std::getenv(ARENA_SNAKES_ENV);
+    const char *threads = std::getenv(ARENA_THREADS_ENV);
+    int width = 0;
+    int height = 0;
+
+    config.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (grid) {
+        if (std::sscanf(grid, "%dx%d", &width, &height) != 2 || width < 8 ||
+            height < 8 || width > ARENA_MAX_GRID || height > ARENA_MAX_GRID) {
+            std::cerr << "Invalid " << ARENA_GRID_ENV << ": " << grid
+                      << std::endl;
+        } else {
+            config.width = width;
+            config.height = height;
+        }
+    }
+    if (snakes) {
+        if (std::atoi(snakes) < 1 ||
+            std::atoi(snakes) > config.width * config.height / 16)
+            std::cerr << "Invalid " << ARENA_SNAKES_ENV << ": " << snakes
+                      << std::endl;
+        else
+            config.snakes = std::atoi(snakes);
+    }
+    if (threads) {
+        if (std::atoi(threads) < 1)
+            std::cerr << "Invalid " << ARENA_THREADS_ENV << ": " << threads
+                      << std::endl;
+        else
+            config.threads = std::atoi(threads);
+    }
+    return config;
+}
+
+/**
+ * @brief The arena never ends by itself.
+ *
+ * @return false
+ */
+bool SnakeArena::isGameOver(void)
+{
+    return false;
+}
+
+/**
+ * @brief Gets the length of the longest snake.
+ *
+ * @return std::pair<float, std::string> The length and the player name.
+ */
+std::pair<float, std::string> SnakeArena::getScore(void)
+{
+    std::size_t longest = 0;
+
+    for (const ArenaSnake &snake : _simulation->getSnakes())
+        longest = std::max(longest, snake.body.size());
+    return {static_cast<float>(longest), _username};
+}
+
+/**
+ * @brief Checks if the player left the arena.
+ *
+ * @return true after ESCAPE was pressed.
+ */
+bool SnakeArena::isGameEnd(void)
+{
+    return _isEnd;
+}
+
+/**
+ * @brief Gets the library to load when the arena is left.
+ *
+ * @return std::string The menu.
+ */
+std::string SnakeArena::getNewLib(void)
+{
+    return "lib/arcade_menu.so";
+}
+
+/**
+ * @brief The arena moves one tick per frame whatever the time of the frame,
+ * its rate is measured on the wall clock.
+ *
+ * @param dt The time elapsed since the previous frame, unused.
+ */
+void SnakeArena::update(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The arena ticks in handleEvent, not on the fixed steps.
+ *
+ * @param dt The duration of the step, unused.
+ */
+void SnakeArena::fixedUpdate(double dt)
+{
+    (void) dt;
+}
+
+/**
+ * @brief The snakes are drawn on their cells, without interpolation.
+ *
+ * @param alpha The share of a step since the last one, unused.
+ */
+void SnakeArena::setInterpolation(double alpha)
+{
+    (void) alpha;
+}
+
+/**
+ * @brief Advances the arena by one tick.
+ *
+ * @param events The events of the frame, only ESCAPE is used.
+ */
+void SnakeArena::handleEvent(std::vector<RawEvent> events)
+{
+    for (const RawEvent &event : events) {
+        if (event.type == EventType::PRESS &&
+            event.key == EventKey::KEYBOARD_ESCAPE)
+            _isEnd = true;
+    }
+    _simulation->tick();
+    updateTickRate();
+}
+
+/**
+ * @brief Measures the ticks per second, once per second.
+ */
+void SnakeArena::updateTickRate(void)
+{
+    auto now = std::chrono::steady_clock::now();
+    double elapsed = std::chrono::duration<double>(now - _rateStart).count();
+
+    if (elapsed < 1.0)
+        return;
+    _tickRate = (_simulation->getTicks() - _rateTicks) / elapsed;
+    _rateTicks = _simulation->getTicks();
+    _rateStart = now;
+}
+
+/**
+ * @brief Renders the arena: its background, the food, the snakes and the
+ * statistics.
+ *
+ * Only the occupied cells get an entity, the free ones are left to the
+ * background.
+ *
+ * @return std::map<std::string, Entity> The entities of the frame.
+ */
+std::map<std::string, Entity> SnakeArena::renderGame()
+{
+    std::map<std::string, Entity> entities;
+    Entity background;
+
+    background.type = Shape::RECTANGLE;
+    background.x = _offsetX;
+    background.y = 0;
+    background.width = _config.width * _cellSize;
+    background.height = _config.height * _cellSize;
+    background.rotate = 0;
+    background.RGB[0] = 20;
+    background.RGB[1] = 20;
+    background.RGB[2] = 20;
+    background.sprites[DisplayType::TERMINAL] = " ";
+    background.sprites[DisplayType::GRAPHICAL] = "";
+    entities["arena"] = background;
+    addFoodEntities(entities);
+    addSnakeEntities(entities);
+    addTextEntities(entities);
+    return entities;
+}
+
+/**
+ * @brief Adds a colored entity for every segment of every snake.
+ *
+ * @param entities The map to add entities to.
+ */
+void SnakeArena::addSnakeEntities(std::map<std::string, Entity> &entities)
+{
+    const std::vector<ArenaSnake> &snakes = _simulation->getSnakes();
+
+    for (std::size_t id = 0; id < snakes.size(); id++) {
+        const int *color = SNAKE_COLORS[id % std::size(SNAKE_COLORS)];
+        std::string prefix = "snake_" + std::to_string(id) + "_";
+        for (std::size_t i = 0; i < snakes[id].body.size(); i++) {
+            entities[prefix + std::to_string(i)] = createCellEntity(
+                snakes[id].body[i], color[0], color[1], color[2],
+                i == 0 ? "H" : "S");
+        }
+    }
+}
+
+/**
+ * @brief Adds an entity for every food of the arena.
+ *
+ * @param entities The map to add entities to.
+ */
+void SnakeArena::addFoodEntities(std::map<std::string, Entity> &entities)
+{
+    const IndexSet &food = _simulation->getFood();
+
+    for (std::size_t i = 0; i < food.size(); i++)
+        entities["food_" + std::to_string(i)] =
+            createCellEntity(food[i], 0, 255, 0, "F");
+}
+
+/**
+ * @brief Adds the statistics of the simulation on the left of the screen.
+ *
+ * @param entities The map to add entities to.
+ */
+void SnakeArena::addTextEntities(std::map<std::string, Entity> &entities)
+{
+    std::size_t alive = 0;
+
+    for (const ArenaSnake &snake : _simulation->getSnakes())
+        alive += snake.isAlive;
+    entities["text_title"] = createTextEntity("Snake Arena", 10);
+    entities["text_snakes"] = createTextEntity("Snakes: " +
+        std::to_string(alive), 50);
+    entities["text_ticks"] = createTextEntity("Ticks: " +
+        std::to_string(_simulation->getTicks()), 90);
+    entities["text_deaths"] = createTextEntity("Deaths: " +
+        std::to_string(_simulation->getDeaths()), 130);
+    entities["text_threads"] = createTextEntity("Threads: " +
+        std::to_string(_simulation->getThreadCount()), 170);
+    entities["text_rate"] = createTextEntity("Ticks/s: " +
+        std::to_string(static_cast<int>(_tickRate)), 210);
+}
+
+/**
+ * @brief Creates the entity of a cell of the arena.
+ *
+ * @param cell The index of the cell.
+ * @param r The red component of the color.
+ * @param g The green component of the color.
+ * @param b The blue component of the color.
+ * @param terminalSprite The character drawn by the terminal displays.
+ * @return Entity The entity of the cell.
+ */
+Entity SnakeArena::createCellEntity(int cell, int r, int g, int b,
+    const std::string &terminalSprite) const
+{
+    Entity entity;
+
+    entity.type = Shape::RECTANGLE;
+    entity.x = _offsetX + cell % _config.width * _cellSize;
+    entity.y = cell / _config.width * _cellSize;
+    entity.width = _cellSize;
+    entity.height = _cellSize;
+    entity.rotate = 0;
+    entity.RGB[0] = r;
+    entity.RGB[1] = g;
+    entity.RGB[2] = b;
+    entity.sprites[DisplayType::TERMINAL] = terminalSprite;
+    entity.sprites[DisplayType::GRAPHICAL] = "";
+    return entity;
+}
+
+/**
+ * @brief Creates a line of text of the statistics.
+ *
+ * @param text The text.
+ * @param y The y-coordinate of the line.
+ * @return Entity The text entity.
+ */
+Entity SnakeArena::createTextEntity(const std::string &text, int y) const
+{
+    Entity entity;
+
+    entity.type = Shape::TEXT;
+    entity.x = 20;
+    entity.y = y;
+    entity.width = 20;
+    entity.height = 20;
+    entity.rotate = 0;
+    entity.RGB[0] = 255;
+    entity.RGB[1] = 255;
+    entity.RGB[2] = 255;
+    entity.sprites[DisplayType::TERMINAL] = text;
+    entity.sprites[DisplayType::GRAPHICAL] = text;
+    return entity;
+}
+
+/**
+ * @brief The arena does not change the display.
+ *
+ * @return std::string An empty string.
+ */
+std::string SnakeArena::getNewDisplay(void)
+{
+    return "";
+}
+
+/**
+ * @brief Gets the name of the game.
+ *
+ * @return std::string The library name.
+ */
+std::string SnakeArena::getName(void)
+{
+    return LIBRARY_NAME;
+}
+
+/**
+ * @brief Sets the name of the player.
+ *
+ * @param username The name of the player.
+ */
+void SnakeArena::setUsername(std::string username)
+{
+    _username = username;
+}
+
+/**
+ * @brief Restarts the arena from a seed.
+ *
+ * @param seed The seed, the same seed gives the same arena whatever the
+ * number of threads.
+ */
+void SnakeArena::setSeed(std::uint64_t seed)
+{
+    _config.seed = seed;
+    _simulation = std::make_unique<ArenaSimulation>(_config);
+    _rateTicks = 0;
+    _rateStart = std::chrono::steady_clock::now();
+}
+
+/**
+ * @brief extern c
+ *
+ */
+extern "C"
+{
+    SnakeArena *GameEntryPoint(void)
+    {
+        return new SnakeArena();
+    }
+
+    std::string getName(void)
+    {
+        return LIBRARY_NAME;
+    }
+
+    LibType getType(void)
+    {
+        return GAME;
+    }
+}
@@ -0,0 +1,79 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** SnakeArena
+*/
+
+#ifndef SNAKEARENA_HPP_
+    #define SNAKEARENA_HPP_
+
+    #include <chrono>
+    #include <map>
+    #include <memory>
+    #include <string>
+    #include <vector>
+    #include "../interfaces/IGame.hpp"
+    #include "ArenaSimulation.hpp"
+
+    #define LIBRARY_NAME "SnakeArena"
+
+    // Side of the square the arena is drawn in, on the right of the screen
+    #define ARENA_VIEW_SIZE 760
+
+    // "<width>x<height>" of the arena, at most one pixel per cell of the view
+    #define ARENA_GRID_ENV "ARCADE_ARENA_GRID"
+    #define ARENA_MAX_GRID ARENA_VIEW_SIZE
+    // Number of snakes, and of threads simulating them (default: one per core)
+    #define ARENA_SNAKES_ENV "ARCADE_ARENA_SNAKES"
+    #define ARENA_THREADS_ENV "ARCADE_ARENA_THREADS"
+
+/**
+ * @brief AI snakes racing for food on a shared grid
+ *
+ * The arena advances one tick per frame and is only watched; ESCAPE goes
+ * back to the menu. It stands as a CPU load for the cabinets, the ticks
+ * per second are shown next to the number of threads.
+ */
+class SnakeArena : public IGame {
+    public:
+        SnakeArena();
+        ~SnakeArena();
+
+        bool isGameOver(void) override;
+        std::pair<float, std::string> getScore(void) override;
+        bool isGameEnd(void) override;
+        std::string getNewLib(void) override;
+        void handleEvent(std::vector<RawEvent>) override;
+        void update(double dt) override;
+        void fixedUpdate(double dt) override;
+        void setInterpolation(double alpha) override;
+        std::map<std::string, Entity> renderGame() override;
+        std::string getNewDisplay(void) override;
+        std::string getName(void) override;
+        void setUsername(std::string username) final;
+        void setSeed(std::uint64_t seed) final;
+
+        static ArenaConfig loadConfigFromEnv(void);
+
+    private:
+        void updateTickRate(void);
+        void addSnakeEntities(std::map<std::string, Entity> &entities);
+        void addFoodEntities(std::map<std::string, Entity> &entities);
+        void addTextEntities(std::map<std::string, Entity> &entities);
+        Entity createCellEntity(int cell, int r, int g, int b,
+            const std::string &terminalSprite) const;
+        Entity createTextEntity(const std::string &text, int y) const;
+
+        ArenaConfig _config;
+        std::unique_ptr<ArenaSimulation> _simulation;
+        std::string _username;
+        bool _isEnd = false;
+        int _cellSize = 1;
+        int _offsetX = 0;
+        std::chrono::steady_clock::time_point _rateStart;
+        std::uint64_t _rateTicks = 0;
+        double _tickRate = 0;
+};
+
+#endif /* !SNAKEARENA_HPP_ */
@@ -8,9 +8,11 @@
 #ifndef IGAME_HPP_
     #define IGAME_HPP_
 
+    #include <cstdint>
     #include <string>
     #include "../../../interfaces/IType.hpp"
     #include <map>
+    #include <vector>
 
 
 using LibraryName = std::string;
@@ -41,12 +43,22 @@ class IGame {
         virtual std::string getNewDisplay(void) = 0;
 
         virtual void handleEvent(std::vector<RawEvent>) = 0;
+        // Advance the clock of the game by dt seconds, once per frame
+        // before handleEvent; the timers of the games only read this clock
+        virtual void update(double dt) = 0;
+        // Advance the simulation by one fixed step of dt seconds, after
+        // handleEvent; the core runs as many steps as the frames took time
+        virtual void fixedUpdate(double dt) = 0;
+        // Share of a fixed step elapsed since the last one, in [0, 1),
+        // given before renderGame to draw between two steps
+        virtual void setInterpolation(double alpha) = 0;
 
         using EntityName = std::string;
         virtual std::map<EntityName, Entity> renderGame() = 0;
 
         virtual std::string getName(void) = 0;
         virtual void setUsername(std::string username) = 0;
+        virtual void setSeed(std::uint64_t seed) = 0;
 
     protected:
     private:
@@ -0,0 +1,118 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** BitGrid
+*/
+
+#ifndef BITGRID_HPP_
+    #define BITGRID_HPP_
+
+    #include <cstddef>
+    #include <cstdint>
+    #include <vector>
+
+/**
+ * @brief Bitplane of a 2D grid, one bit per cell
+ *
+ * The bits follow the row-major order of Grid2D and are packed in 64-bit
+ * words, so that several planes can be combined or counted a word at a
+ * time. The bits past the last cell are always 0.
+ */
+class BitGrid {
+    public:
+        BitGrid() = default;
+
+        BitGrid(int width, int height)
+        {
+            reset(width, height);
+        }
+
+        /**
+         * @brief Resize the plane and clear every bit
+         *
+         * @param width The number of columns
+         * @param height The number of rows
+         */
+        void reset(int width, int height)
+        {
+            _width = width;
+            _height = height;
+            _words.assign((static_cast<std::size_t>(width) * height + 63) / 64,
+                0);
+        }
+
+        /**
+         * @brief Clear every bit, keeping the size
+         */
+        void clear(void)
+        {
+            _words.assign(_words.size(), 0);
+        }
+
+        int getWidth(void) const
+        {
+            return _width;
+        }
+
+        int getHeight(void) const
+        {
+            return _height;
+        }
+
+        int index(int x, int y) const
+        {
+            return y * _width + x;
+        }
+
+        bool test(int index) const
+        {
+            return (_words[index >> 6] >> (index & 63)) & 1;
+        }
+
+        bool test(int x, int y) const
+        {
+            return test(index(x, y));
+        }
+
+        void set(int index, bool value = true)
+        {
+            std::uint64_t mask = std::uint64_t(1) << (index & 63);
+
+            if (value)
+                _words[index >> 6] |= mask;
+            else
+                _words[index >> 6] &= ~mask;
+        }
+
+        void set(int x, int y, bool value = true)
+        {
+            set(index(x, y), value);
+        }
+
+        /**
+         * @brief Count the set bits
+         *
+         * @return std::size_t The number of cells whose bit is set
+         */
+        std::size_t count(void) const
+        {
+            std::size_t total = 0;
+
+            for (std::uint64_t word : _words)
+                total += __builtin_popcountll(word);
+            return total;
+        }
+
+        const std::vector<std::uint64_t> &getWords(void) const
+        {
+            return _words;
+        }
+
+    private:
+        int _width = 0;
+        int _height = 0;
+        std::vector<std::uint64_t> _words;
+};
+
+#endif /* !BITGRID_HPP_ */
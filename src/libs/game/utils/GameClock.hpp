@@ -0,0 +1,63 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** GameClock
+*/
+
+#ifndef GAMECLOCK_HPP_
+    #define GAMECLOCK_HPP_
+
+    #include <chrono>
+    #include <cstdint>
+
+/**
+ * @brief Time of a game instance, advanced by the host
+ *
+ * The clock starts at zero and only moves when IGame::update gives it the
+ * time of a frame, so that two instances never share their timers and a
+ * replay fed the recorded frame times sees the same timeline. Its time
+ * points are steady_clock ones, the timers of the games keep their type.
+ */
+class GameClock {
+    public:
+        using TimePoint = std::chrono::steady_clock::time_point;
+
+        GameClock() = default;
+
+        /**
+         * @brief Move the clock forward
+         *
+         * @param dt The time of the frame in seconds, ignored if negative
+         */
+        void advance(double dt)
+        {
+            if (dt <= 0)
+                return;
+            _elapsed += std::chrono::duration_cast<
+                std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(dt));
+            _ticks++;
+        }
+
+        TimePoint now(void) const
+        {
+            return TimePoint(_elapsed);
+        }
+
+        /**
+         * @brief Get the number of frames the clock was advanced by
+         *
+         * @return std::uint64_t The number of calls to advance
+         */
+        std::uint64_t getTicks(void) const
+        {
+            return _ticks;
+        }
+
+    private:
+        std::chrono::steady_clock::duration _elapsed{0};
+        std::uint64_t _ticks = 0;
+};
+
+#endif /* !GAMECLOCK_HPP_ */
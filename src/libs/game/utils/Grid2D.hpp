@@ -0,0 +1,137 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Grid2D
+*/
+
+#ifndef GRID2D_HPP_
+    #define GRID2D_HPP_
+
+    #include <cstddef>
+    #include <vector>
+
+/**
+ * @brief Row-major contiguous 2D grid
+ *
+ * All the cells live in a single vector, so that a whole-board scan walks
+ * memory linearly instead of chasing one pointer per row. Cells can be
+ * addressed by (x, y) or by their index, y * width + x.
+ *
+ * Flags that are tested over the whole board are better stored apart in a
+ * BitGrid, one bitplane per flag.
+ *
+ * @tparam T The type of a cell
+ */
+template <typename T>
+class Grid2D {
+    public:
+        Grid2D() = default;
+
+        Grid2D(int width, int height, const T &value = T())
+        {
+            reset(width, height, value);
+        }
+
+        /**
+         * @brief Resize the grid and fill every cell with a value
+         *
+         * @param width The number of columns
+         * @param height The number of rows
+         * @param value The value of every cell
+         */
+        void reset(int width, int height, const T &value = T())
+        {
+            _width = width;
+            _height = height;
+            _cells.assign(static_cast<std::size_t>(width) * height, value);
+        }
+
+        int getWidth(void) const
+        {
+            return _width;
+        }
+
+        int getHeight(void) const
+        {
+            return _height;
+        }
+
+        std::size_t size(void) const
+        {
+            return _cells.size();
+        }
+
+        bool inBounds(int x, int y) const
+        {
+            return x >= 0 && x < _width && y >= 0 && y < _height;
+        }
+
+        int index(int x, int y) const
+        {
+            return y * _width + x;
+        }
+
+        T &at(int x, int y)
+        {
+            return _cells[index(x, y)];
+        }
+
+        const T &at(int x, int y) const
+        {
+            return _cells[index(x, y)];
+        }
+
+        T &operator[](std::size_t index)
+        {
+            return _cells[index];
+        }
+
+        const T &operator[](std::size_t index) const
+        {
+            return _cells[index];
+        }
+
+        /**
+         * @brief Get the first cell of a row, the row is contiguous
+         *
+         * @param y The row
+         * @return T* The cells of the row
+         */
+        T *row(int y)
+        {
+            return _cells.data() + index(0, y);
+        }
+
+        const T *row(int y) const
+        {
+            return _cells.data() + index(0, y);
+        }
+
+        typename std::vector<T>::iterator begin(void)
+        {
+            return _cells.begin();
+        }
+
+        typename std::vector<T>::iterator end(void)
+        {
+            return _cells.end();
+        }
+
+        typename std::vector<T>::const_iterator begin(void) const
+        {
+            return _cells.begin();
+        }
+
+        typename std::vector<T>::const_iterator end(void) const
+        {
+            return _cells.end();
+        }
+
+    private:
+        int _width = 0;
+        int _height = 0;
+        std::vector<T> _cells;
+};
+
+#endif /* !GRID2D_HPP_ */
@@ -0,0 +1,112 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** IndexSet
+*/
+
+#ifndef INDEXSET_HPP_
+    #define INDEXSET_HPP_
+
+    #include <cstddef>
+    #include <vector>
+
+/**
+ * @brief Set of the integers below a bound, with O(1) insert, erase and
+ * random access
+ *
+ * The members are packed in a dense array and every integer of the
+ * universe knows its place in it, so a member is erased by moving the last
+ * one into its slot. The order of the members is therefore not stable.
+ * Nothing is allocated once reset.
+ */
+class IndexSet {
+    public:
+        IndexSet() = default;
+
+        explicit IndexSet(int universe)
+        {
+            reset(universe);
+        }
+
+        /**
+         * @brief Empty the set and bound its members
+         *
+         * @param universe The members are in [0, universe)
+         */
+        void reset(int universe)
+        {
+            _dense.clear();
+            _dense.reserve(universe);
+            _position.assign(universe, -1);
+        }
+
+        void clear(void)
+        {
+            for (int member : _dense)
+                _position[member] = -1;
+            _dense.clear();
+        }
+
+        std::size_t size(void) const
+        {
+            return _dense.size();
+        }
+
+        bool empty(void) const
+        {
+            return _dense.empty();
+        }
+
+        bool contains(int value) const
+        {
+            return _position[value] >= 0;
+        }
+
+        void insert(int value)
+        {
+            if (contains(value))
+                return;
+            _position[value] = _dense.size();
+            _dense.push_back(value);
+        }
+
+        void erase(int value)
+        {
+            int position = _position[value];
+
+            if (position < 0)
+                return;
+            _dense[position] = _dense.back();
+            _position[_dense[position]] = position;
+            _dense.pop_back();
+            _position[value] = -1;
+        }
+
+        /**
+         * @brief Get a member by its place in the dense array
+         *
+         * @param index The place, below size()
+         * @return int The member
+         */
+        int operator[](std::size_t index) const
+        {
+            return _dense[index];
+        }
+
+        std::vector<int>::const_iterator begin(void) const
+        {
+            return _dense.begin();
+        }
+
+        std::vector<int>::const_iterator end(void) const
+        {
+            return _dense.end();
+        }
+
+    private:
+        std::vector<int> _dense;
+        std::vector<int> _position;
+};
+
+#endif /* !INDEXSET_HPP_ */
@@ -0,0 +1,133 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** Random
+*/
+
+#ifndef RANDOM_HPP_
+    #define RANDOM_HPP_
+
+    #include <cstdint>
+    #include <limits>
+
+    #define RANDOM_DEFAULT_SEED 0x41524341444531ULL
+
+/**
+ * @brief Per-instance xoshiro256** pseudo-random generator
+ *
+ * Unlike rand(), each game owns its generator, so sequences are
+ * reproducible from a seed and independent between games and threads.
+ * It satisfies UniformRandomBitGenerator and can be used with <random>
+ * and <algorithm>.
+ */
+class Random {
+    public:
+        using result_type = std::uint64_t;
+
+        explicit Random(std::uint64_t seed = RANDOM_DEFAULT_SEED)
+        {
+            setSeed(seed);
+        }
+
+        /**
+         * @brief Restart the sequence from a seed
+         *
+         * The state is expanded from the seed with splitmix64, so any
+         * seed, including 0, gives a valid state.
+         *
+         * @param seed The seed
+         */
+        void setSeed(std::uint64_t seed)
+        {
+            for (auto &word : _state) {
+                seed += 0x9E3779B97F4A7C15ULL;
+                std::uint64_t z = seed;
+                z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+                z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+                word = z ^ (z >> 31);
+            }
+        }
+
+        /**
+         * @brief Get the next 64 random bits
+         *
+         * @return std::uint64_t The random value
+         */
+        std::uint64_t next(void)
+        {
+            std::uint64_t result = rotl(_state[1] * 5, 7) * 9;
+            std::uint64_t t = _state[1] << 17;
+
+            _state[2] ^= _state[0];
+            _state[3] ^= _state[1];
+            _state[1] ^= _state[2];
+            _state[0] ^= _state[3];
+            _state[2] ^= t;
+            _state[3] = rotl(_state[3], 45);
+            return result;
+        }
+
+        result_type operator()(void)
+        {
+            return next();
+        }
+
+        /**
+         * @brief Get a uniform value in [0, bound)
+         *
+         * Uses Lemire's multiply-shift rejection, which is unbiased and
+         * avoids the division of a modulo in the common case.
+         *
+         * @param bound The exclusive upper bound, must not be 0
+         * @return std::uint64_t The random value
+         */
+        std::uint64_t below(std::uint64_t bound)
+        {
+            unsigned __int128 product =
+                static_cast<unsigned __int128>(next()) * bound;
+            std::uint64_t low = static_cast<std::uint64_t>(product);
+
+            if (low < bound) {
+                std::uint64_t threshold = -bound % bound;
+                while (low < threshold) {
+                    product = static_cast<unsigned __int128>(next()) * bound;
+                    low = static_cast<std::uint64_t>(product);
+                }
+            }
+            return static_cast<std::uint64_t>(product >> 64);
+        }
+
+        /**
+         * @brief Get a uniform integer in [min, max]
+         *
+         * @param min The inclusive lower bound
+         * @param max The inclusive upper bound
+         * @return int The random value
+         */
+        int range(int min, int max)
+        {
+            return min + static_cast<int>(below(
+                static_cast<std::uint64_t>(max - min) + 1));
+        }
+
+        static constexpr result_type min(void)
+        {
+            return 0;
+        }
+
+        static constexpr result_type max(void)
+        {
+            return std::numeric_limits<result_type>::max();
+        }
+
+    private:
+        static std::uint64_t rotl(std::uint64_t x, int k)
+        {
+            return (x << k) | (x >> (64 - k));
+        }
+
+        std::uint64_t _state[4];
+};
+
+#endif /* !RANDOM_HPP_ */
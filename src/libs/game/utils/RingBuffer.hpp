@@ -0,0 +1,143 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** RingBuffer
+*/
+
+#ifndef RINGBUFFER_HPP_
+    #define RINGBUFFER_HPP_
+
+    #include <cstddef>
+    #include <vector>
+
+/**
+ * @brief Fixed-capacity double-ended queue over a circular array
+ *
+ * Pushing or popping at either end is O(1) and never moves the other
+ * elements nor allocates once reset. Element 0 is the front. Pushing into
+ * a full buffer is not checked, the capacity must bound the size.
+ *
+ * @tparam T The type of an element
+ */
+template <typename T>
+class RingBuffer {
+    public:
+        RingBuffer() = default;
+
+        explicit RingBuffer(std::size_t capacity)
+        {
+            reset(capacity);
+        }
+
+        /**
+         * @brief Empty the buffer and set its capacity
+         *
+         * @param capacity The maximum number of elements
+         */
+        void reset(std::size_t capacity)
+        {
+            _elements.assign(capacity, T());
+            _front = 0;
+            _size = 0;
+        }
+
+        void clear(void)
+        {
+            _front = 0;
+            _size = 0;
+        }
+
+        std::size_t size(void) const
+        {
+            return _size;
+        }
+
+        std::size_t capacity(void) const
+        {
+            return _elements.size();
+        }
+
+        bool empty(void) const
+        {
+            return _size == 0;
+        }
+
+        bool full(void) const
+        {
+            return _size == _elements.size();
+        }
+
+        void pushFront(const T &value)
+        {
+            _front = _front == 0 ? _elements.size() - 1 : _front - 1;
+            _elements[_front] = value;
+            _size++;
+        }
+
+        void pushBack(const T &value)
+        {
+            _elements[wrap(_front + _size)] = value;
+            _size++;
+        }
+
+        void popFront(void)
+        {
+            _front = wrap(_front + 1);
+            _size--;
+        }
+
+        void popBack(void)
+        {
+            _size--;
+        }
+
+        T &front(void)
+        {
+            return _elements[_front];
+        }
+
+        const T &front(void) const
+        {
+            return _elements[_front];
+        }
+
+        T &back(void)
+        {
+            return (*this)[_size - 1];
+        }
+
+        const T &back(void) const
+        {
+            return (*this)[_size - 1];
+        }
+
+        T &operator[](std::size_t index)
+        {
+            return _elements[wrap(_front + index)];
+        }
+
+        const T &operator[](std::size_t index) const
+        {
+            return _elements[wrap(_front + index)];
+        }
+
+    private:
+        /**
+         * @brief Bring a position past the end back into the array
+         *
+         * Positions are never more than one capacity past the end, so a
+         * subtraction is enough where a modulo would divide.
+         */
+        std::size_t wrap(std::size_t position) const
+        {
+            return position >= _elements.size() ?
+                position - _elements.size() : position;
+        }
+
+        std::vector<T> _elements;
+        std::size_t _front = 0;
+        std::size_t _size = 0;
+};
+
+#endif /* !RINGBUFFER_HPP_ */
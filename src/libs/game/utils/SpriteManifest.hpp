@@ -0,0 +1,152 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** SpriteManifest
+*/
+
+#ifndef SPRITEMANIFEST_HPP_
+    #define SPRITEMANIFEST_HPP_
+
+    #include <algorithm>
+    #include <filesystem>
+    #include <fstream>
+    #include <iomanip>
+    #include <iostream>
+    #include <sstream>
+    #include <string>
+    #include <vector>
+    #include "../interfaces/IGame.hpp"
+
+/**
+ * @brief How one kind of cell is drawn
+ */
+struct ManifestSprite {
+    std::string terminal;
+    std::string graphical;
+    int RGB[3] = {255, 255, 255};
+
+    void apply(Entity &entity) const
+    {
+        entity.sprites[DisplayType::TERMINAL] = terminal;
+        entity.sprites[DisplayType::GRAPHICAL] = graphical;
+        entity.RGB[0] = RGB[0];
+        entity.RGB[1] = RGB[1];
+        entity.RGB[2] = RGB[2];
+    }
+};
+
+/**
+ * @brief Sprites of an asset pack, read from a text manifest
+ *
+ * The game names its kinds of cells, the manifest gives one line per kind:
+ *
+ *     <kind> "<terminal sprite>" "<graphical sprite>" <r> <g> <b>
+ *
+ * plus an optional `name "<name>"` line; empty lines and lines starting
+ * with '#' are skipped. The manifest is read once, then a sprite is found
+ * by the index of its kind, so drawing a cell copies strings without
+ * building them.
+ */
+class SpriteManifest {
+    public:
+        /**
+         * @brief Build a pack with a blank sprite for every kind
+         *
+         * @param kindCount The number of kinds of the game
+         */
+        explicit SpriteManifest(std::size_t kindCount = 0)
+            : _sprites(kindCount)
+        {
+        }
+
+        /**
+         * @brief Read a manifest, every kind must be given
+         *
+         * @param path The path of the manifest
+         * @param kinds The names of the kinds, in the order of their index
+         * @return true on success, false if the file is missing or invalid
+         */
+        bool load(const std::string &path, const std::vector<std::string> &kinds)
+        {
+            std::ifstream file(path);
+            std::vector<bool> isSet(kinds.size(), false);
+            std::string line;
+            int lineNumber = 0;
+
+            if (!file.is_open()) {
+                std::cerr << "Unable to open sprite manifest: " << path << std::endl;
+                return false;
+            }
+            _name = std::filesystem::path(path).stem().string();
+            _sprites.assign(kinds.size(), ManifestSprite());
+            while (std::getline(file, line)) {
+                std::istringstream stream(line);
+                std::string kind;
+                ManifestSprite sprite;
+
+                lineNumber++;
+                if (!(stream >> kind) || kind[0] == '#')
+                    continue;
+                if (kind == "name" && stream >> std::quoted(_name))
+                    continue;
+                auto it = std::find(kinds.begin(), kinds.end(), kind);
+                if (it == kinds.end() || !(stream >> std::quoted(sprite.terminal)
+                    >> std::quoted(sprite.graphical) >> sprite.RGB[0]
+                    >> sprite.RGB[1] >> sprite.RGB[2])) {
+                    std::cerr << "Invalid sprite manifest: " << path << ":"
+                              << lineNumber << std::endl;
+                    return false;
+                }
+                _sprites[it - kinds.begin()] = sprite;
+                isSet[it - kinds.begin()] = true;
+            }
+            for (std::size_t i = 0; i < kinds.size(); i++) {
+                if (!isSet[i]) {
+                    std::cerr << "Invalid sprite manifest: " << path
+                              << ": no sprite for " << kinds[i] << std::endl;
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /**
+         * @brief List the manifests of a directory
+         *
+         * @param directory The directory to look in
+         * @param extension The extension of the manifests, with its dot
+         * @return std::vector<std::string> Their paths, sorted by name
+         */
+        static std::vector<std::string> list(const std::string &directory,
+            const std::string &extension)
+        {
+            std::vector<std::string> paths;
+            std::error_code error;
+
+            for (const auto &entry :
+                std::filesystem::directory_iterator(directory, error)) {
+                if (entry.is_regular_file() &&
+                    entry.path().extension() == extension)
+                    paths.push_back(entry.path().string());
+            }
+            std::sort(paths.begin(), paths.end());
+            return paths;
+        }
+
+        const std::string &getName(void) const
+        {
+            return _name;
+        }
+
+        const ManifestSprite &operator[](std::size_t kind) const
+        {
+            return _sprites[kind];
+        }
+
+    private:
+        std::string _name;
+        std::vector<ManifestSprite> _sprites;
+};
+
+#endif /* !SPRITEMANIFEST_HPP_ */
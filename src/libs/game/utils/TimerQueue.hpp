@@ -0,0 +1,122 @@
+/*
+** EPITECH PROJECT, 2025
+** Arcade
+** File description:
+** TimerQueue
+*/
+
+#ifndef TIMERQUEUE_HPP_
+    #define TIMERQUEUE_HPP_
+
+    #include <algorithm>
+    #include <chrono>
+    #include <cstdint>
+    #include <functional>
+    #include <vector>
+    #include "GameClock.hpp"
+
+/**
+ * @brief Callbacks run once the clock of a game passes their deadline
+ *
+ * A game asks for a timer instead of waiting, and runs the queue from
+ * IGame::update with the time of its clock: the host keeps polling and
+ * drawing while the timer runs. The timers due at the same time run in
+ * the order they were scheduled, and a callback may schedule or cancel
+ * timers.
+ */
+class TimerQueue {
+    public:
+        using TimerId = std::uint64_t;
+        using Callback = std::function<void()>;
+
+        TimerQueue() = default;
+
+        /**
+         * @brief Schedule a callback
+         *
+         * @param now The current time of the clock of the game
+         * @param delay The time to wait in seconds
+         * @param callback The function to run once the delay is over
+         * @return TimerId The id of the timer, to cancel it
+         */
+        TimerId schedule(GameClock::TimePoint now, double delay,
+            Callback callback)
+        {
+            Timer timer = {now + std::chrono::duration_cast<
+                std::chrono::steady_clock::duration>(
+                std::chrono::duration<double>(std::max(delay, 0.0))),
+                ++_lastId, std::move(callback)};
+
+            _timers.push_back(std::move(timer));
+            std::push_heap(_timers.begin(), _timers.end(), isLater);
+            return _lastId;
+        }
+
+        /**
+         * @brief Remove a timer before it runs
+         *
+         * @param id The id given by schedule
+         * @return true if the timer was still pending
+         */
+        bool cancel(TimerId id)
+        {
+            auto it = std::find_if(_timers.begin(), _timers.end(),
+                [id](const Timer &timer) { return timer.id == id; });
+
+            if (it == _timers.end())
+                return false;
+            _timers.erase(it);
+            std::make_heap(_timers.begin(), _timers.end(), isLater);
+            return true;
+        }
+
+        void clear(void)
+        {
+            _timers.clear();
+        }
+
+        std::size_t size(void) const
+        {
+            return _timers.size();
+        }
+
+        bool empty(void) const
+        {
+            return _timers.empty();
+        }
+
+        /**
+         * @brief Run the callbacks of the timers due at a time
+         *
+         * @param now The current time of the clock of the game
+         */
+        void run(GameClock::TimePoint now)
+        {
+            while (!_timers.empty() && _timers.front().deadline <= now) {
+                std::pop_heap(_timers.begin(), _timers.end(), isLater);
+                Callback callback = std::move(_timers.back().callback);
+                _timers.pop_back();
+                callback();
+            }
+        }
+
+    private:
+        struct Timer {
+            GameClock::TimePoint deadline;
+            TimerId id;
+            Callback callback;
+        };
+
+        // Heap order: the earliest deadline, then the first scheduled, on top
+        static bool isLater(const Timer &a, const Timer &b)
+        {
+            if (a.deadline != b.deadline)
+                return a.deadline > b.deadline;
+            return a.id > b.id;
+        }
+
+        std::vector<Timer> _timers;
+        TimerId _lastId = 0;
+};
+
+#endif /* !TIMERQUEUE_HPP_ */
@@ -10,6 +10,7 @@
 #include <filesystem>
 #include <vector>
 #include <cstring>
+#include <string>
 #include "core/Core.hpp"
 
 
@@ -17,9 +18,22 @@
 static void print_help()
 {
     std::cout << "USAGE" << std::endl;
-    std::cout << "\t./arcade lib" << std::endl;
+    std::cout << "\t./arcade lib [options]" << std::endl;
     std::cout << "DESCRIPTION" << std::endl;
     std::cout << "\tpath\tPath to the display library" << std::endl;
+    std::cout << "OPTIONS" << std::endl;
+    std::cout << "\t--profile-out file\tDump the frame profile on exit "
+                 "(CSV if file ends with .csv, JSON otherwise)" << std::endl;
+    std::cout << "\t--trace-out file\tRecord a Chrome trace of the frames "
+                 "and write it on exit or on demand" << std::endl;
+    std::cout << "\t--record file\t\tRecord the input of the session"
+              << std::endl;
+    std::cout << "\t--replay file\t\tReplay a recorded session instead of "
+                 "reading the input" << std::endl;
+    std::cout << "\t--seed number\t\tSeed of the random generators of the "
+                 "games (random by default)" << std::endl;
+    std::cout << "\t--alloc-track\t\tAttribute the allocations of each frame "
+                 "to the game, the display or the core" << std::endl;
     std::cout << "CONTROLS" << std::endl;
     std::cout << "\tF1: Previous Sprite Set" << std::endl;
     std::cout << "\tF2: Next Sprite Set" << std::endl;
@@ -32,17 +46,54 @@ static void print_help()
     std::cout << "\tF9: Next Display Lib" << std::endl;
     std::cout << "\tF10: Go back to Menu" << std::endl;
     std::cout << "\tF11: Exit" << std::endl;
+    std::cout << "\tInsert: Toggle the profiler overlay" << std::endl;
+    std::cout << "\tHome: Write the trace (with --trace-out)" << std::endl;
+}
+
+static bool parse_options(int ac, char **av, CoreOptions &options)
+{
+    for (int i = 2; i < ac; i++) {
+        if (strcmp(av[i], "--profile-out") == 0 && i + 1 < ac) {
+            options.profileOut = av[++i];
+        } else if (strcmp(av[i], "--trace-out") == 0 && i + 1 < ac) {
+            options.traceOut = av[++i];
+        } else if (strcmp(av[i], "--record") == 0 && i + 1 < ac) {
+            options.recordPath = av[++i];
+        } else if (strcmp(av[i], "--replay") == 0 && i + 1 < ac) {
+            options.replayPath = av[++i];
+        } else if (strcmp(av[i], "--alloc-track") == 0) {
+            options.allocTrack = true;
+        } else if (strcmp(av[i], "--seed") == 0 && i + 1 < ac) {
+            try {
+                options.seed = std::stoull(av[++i], nullptr, 0);
+                options.hasSeed = true;
+            } catch (const std::exception &e) {
+                std::cerr << "Invalid seed: " << av[i] << std::endl;
+                return false;
+            }
+        } else {
+            std::cerr << "Invalid option: " << av[i] << std::endl;
+            return false;
+        }
+    }
+    return true;
 }
 
 int main(int ac, char **av)
 {
-    if (ac != 2)
+    CoreOptions options;
+
+    if (ac < 2)
         return 84;
     if (strcmp(av[1], "-h") == 0 || strcmp(av[1], "--help") == 0)
         print_help();
     else {
         const std::string path = av[1];
-        Core core(path);
+        if (!parse_options(ac, av, options))
+            return 84;
+        Core core(path, options);
+        if (core.hasFailed())
+            return 84;
         core.run();
     }
     return 0;